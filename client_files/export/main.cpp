@@ -57,6 +57,7 @@ int main(int argc, char **argv) {
 
 	/* Register Log System and Settings */
 	database.LoadLogSettings(LogSys.log_settings);
+	LogSys.SetFileLogOptions(Config->LogFileAsync, Config->LogFileQueueSize, Config->LogFileBlockWhenFull, Config->LogFileBinary);
 	LogSys.StartFileLogs();
 
 	std::string arg_1;
@@ -55,6 +55,7 @@ int main(int argc, char **argv) {
 	}
 
 	database.LoadLogSettings(LogSys.log_settings);
+	LogSys.SetFileLogOptions(Config->LogFileAsync, Config->LogFileQueueSize, Config->LogFileBlockWhenFull, Config->LogFileBinary);
 	LogSys.StartFileLogs();
 
 	ImportSpells(&database);
@@ -46,6 +46,7 @@ DBcore::DBcore()
 
 DBcore::~DBcore()
 {
+	ClearStatements();
 	mysql_close(&mysql);
 	safe_delete_array(pHost);
 	safe_delete_array(pUser);
@@ -165,6 +166,113 @@ MySQLRequestResult DBcore::QueryDatabase(const char *query, uint32 querylen, boo
 	return requestResult;
 }
 
+MySQLStmtResult DBcore::ExecuteStatement(const std::string &query, const MySQLStmtParams &params, bool retryOnFailureOnce)
+{
+	BenchTimer timer;
+	timer.reset();
+
+	LockMutex lock(&MDatabase);
+
+	// Reconnect if we are not connected before hand.
+	if (pStatus != Connected) {
+		Open();
+	}
+
+	uint32 errorNumber = 0;
+	std::string errorMessage;
+
+	MYSQL_STMT *stmt = GetStatement(query, errorNumber, errorMessage);
+	if (stmt != nullptr) {
+		std::vector<MYSQL_BIND> binds;
+		params.Bind(binds);
+
+		if (params.Count() != mysql_stmt_param_count(stmt)) {
+			errorNumber = 0;
+			errorMessage = fmt::format("Statement expects {} parameters, {} given", mysql_stmt_param_count(stmt), params.Count());
+		}
+		else if ((!binds.empty() && mysql_stmt_bind_param(stmt, &binds[0]) != 0) || mysql_stmt_execute(stmt) != 0) {
+			errorNumber = mysql_stmt_errno(stmt);
+			errorMessage = fmt::format("#{}: {}", errorNumber, mysql_stmt_error(stmt));
+		}
+		else {
+			MySQLStmtResult requestResult(stmt);
+
+			if (LogSys.log_settings[Logs::MySQLQuery].is_category_enabled == 1) {
+				LogMySQLQuery(
+					"{0} [prepared] ({1} row{2} returned, {3} affected) ({4}s)",
+					query,
+					requestResult.RowCount(),
+					requestResult.RowCount() == 1 ? "" : "s",
+					requestResult.RowsAffected(),
+					std::to_string(timer.elapsed())
+				);
+			}
+
+			if (!requestResult.Success()) {
+				LogMySQLError("[{}] [{}]\n[{}]", requestResult.ErrorNumber(), requestResult.ErrorMessage(), query);
+			}
+
+			return requestResult;
+		}
+	}
+
+	// error appears to be a disconnect error, may need to try again.
+	if (errorNumber == CR_SERVER_LOST || errorNumber == CR_SERVER_GONE_ERROR) {
+		pStatus = Error;
+
+		if (retryOnFailureOnce) {
+			LogInfo("Database Error: Lost connection, attempting to recover");
+			MySQLStmtResult requestResult = ExecuteStatement(query, params, false);
+
+			if (requestResult.Success()) {
+				LogInfo("Reconnection to database successful");
+				return requestResult;
+			}
+		}
+
+		return MySQLStmtResult(errorNumber, errorMessage);
+	}
+
+	LogMySQLError("[{}] [{}]\n[{}]", errorNumber, errorMessage, query);
+
+	return MySQLStmtResult(errorNumber, errorMessage);
+}
+
+// Returns the cached statement for query, preparing it on first use
+MYSQL_STMT *DBcore::GetStatement(const std::string &query, uint32 &errnum, std::string &errmsg)
+{
+	auto iter = statements.find(query);
+	if (iter != statements.end()) {
+		return iter->second;
+	}
+
+	MYSQL_STMT *stmt = mysql_stmt_init(&mysql);
+	if (stmt == nullptr) {
+		errnum = mysql_errno(&mysql);
+		errmsg = fmt::format("#{}: {}", errnum, mysql_error(&mysql));
+		return nullptr;
+	}
+
+	if (mysql_stmt_prepare(stmt, query.c_str(), query.length()) != 0) {
+		errnum = mysql_stmt_errno(stmt);
+		errmsg = fmt::format("#{}: {}", errnum, mysql_stmt_error(stmt));
+		mysql_stmt_close(stmt);
+		return nullptr;
+	}
+
+	statements[query] = stmt;
+	return stmt;
+}
+
+void DBcore::ClearStatements()
+{
+	for (auto &iter : statements) {
+		mysql_stmt_close(iter.second);
+	}
+
+	statements.clear();
+}
+
 void DBcore::TransactionBegin()
 {
 	QueryDatabase("START TRANSACTION");
@@ -224,6 +332,7 @@ bool DBcore::Open(uint32 *errnum, char *errbuf)
 		return true;
 	}
 	if (GetStatus() == Error) {
+		ClearStatements(); // handles die with the connection
 		mysql_close(&mysql);
 		mysql_init(&mysql);        // Initialize structure again
 	}
@@ -8,10 +8,12 @@
 
 #include "../common/mutex.h"
 #include "../common/mysql_request_result.h"
+#include "../common/mysql_stmt.h"
 #include "../common/types.h"
 
 #include <mysql.h>
 #include <string.h>
+#include <unordered_map>
 
 class DBcore {
 public:
@@ -22,6 +24,9 @@ public:
 	eStatus	GetStatus() { return pStatus; }
 	MySQLRequestResult	QueryDatabase(const char* query, uint32 querylen, bool retryOnFailureOnce = true);
 	MySQLRequestResult	QueryDatabase(std::string query, bool retryOnFailureOnce = true);
+	// Server side prepared statement, prepared on first use and cached for this connection by query text
+	// Keep the query text constant, values go through params as '?' placeholders
+	MySQLStmtResult	ExecuteStatement(const std::string &query, const MySQLStmtParams &params, bool retryOnFailureOnce = true);
 	void TransactionBegin();
 	void TransactionCommit();
 	void TransactionRollback();
@@ -33,8 +38,11 @@ protected:
 	bool	Open(const char* iHost, const char* iUser, const char* iPassword, const char* iDatabase, uint32 iPort, uint32* errnum = 0, char* errbuf = 0, bool iCompress = false, bool iSSL = false);
 private:
 	bool	Open(uint32* errnum = 0, char* errbuf = 0);
+	MYSQL_STMT*	GetStatement(const std::string &query, uint32 &errnum, std::string &errmsg);
+	void	ClearStatements();
 
 	MYSQL	mysql;
+	std::unordered_map<std::string, MYSQL_STMT*> statements;
 	Mutex	MDatabase;
 	eStatus pStatus;
 
@@ -145,6 +145,14 @@ void EQEmuConfig::parse_config()
 	LogPrefix = _root["server"]["launcher"].get("logprefix", "logs/zone-").asString();
 	LogSuffix = _root["server"]["launcher"].get("logsuffix", ".log").asString();
 
+	LogFileAsync = true;
+	if (_root["server"]["logging"].get("async_file_logs", "true").asString() == "false") { LogFileAsync = false; }
+	LogFileQueueSize = atoi(_root["server"]["logging"].get("async_file_log_queue_size", "8192").asString().c_str());
+	LogFileBlockWhenFull = false;
+	if (_root["server"]["logging"].get("async_file_log_block_when_full", "false").asString() == "true") { LogFileBlockWhenFull = true; }
+	LogFileBinary = false;
+	if (_root["server"]["logging"].get("binary_file_logs", "false").asString() == "true") { LogFileBinary = true; }
+
 	/**
 	 * Launcher
 	 */
@@ -293,6 +301,18 @@ std::string EQEmuConfig::GetByName(const std::string &var_name) const
 	if (var_name == "LogSuffix") {
 		return (LogSuffix);
 	}
+	if (var_name == "LogFileAsync") {
+		return (LogFileAsync ? "true" : "false");
+	}
+	if (var_name == "LogFileQueueSize") {
+		return (itoa(LogFileQueueSize));
+	}
+	if (var_name == "LogFileBlockWhenFull") {
+		return (LogFileBlockWhenFull ? "true" : "false");
+	}
+	if (var_name == "LogFileBinary") {
+		return (LogFileBinary ? "true" : "false");
+	}
 	if (var_name == "ZoneExe") {
 		return (ZoneExe);
 	}
@@ -354,6 +374,10 @@ void EQEmuConfig::Dump() const
 	std::cout << "PatchDir = " << PatchDir << std::endl;
 	std::cout << "SharedMemDir = " << SharedMemDir << std::endl;
 	std::cout << "LogDir = " << LogDir << std::endl;
+	std::cout << "LogFileAsync = " << LogFileAsync << std::endl;
+	std::cout << "LogFileQueueSize = " << LogFileQueueSize << std::endl;
+	std::cout << "LogFileBlockWhenFull = " << LogFileBlockWhenFull << std::endl;
+	std::cout << "LogFileBinary = " << LogFileBinary << std::endl;
 	std::cout << "ZonePortLow = " << ZonePortLow << std::endl;
 	std::cout << "ZonePortHigh = " << ZonePortHigh << std::endl;
 	std::cout << "DefaultStatus = " << (int) DefaultStatus << std::endl;
@@ -96,6 +96,12 @@ class EQEmuConfig
 		std::string SharedMemDir;
 		std::string LogDir;
 
+		// From <logging/>
+		bool LogFileAsync;
+		uint32 LogFileQueueSize;
+		bool LogFileBlockWhenFull;
+		bool LogFileBinary;
+
 		// From <launcher/>
 		std::string LogPrefix;
 		std::string LogSuffix;
@@ -31,6 +31,9 @@
 #include <iomanip>
 #include <time.h>
 #include <sys/stat.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
 
 std::ofstream process_log;
 
@@ -82,6 +85,250 @@ namespace Console {
 	};
 }
 
+namespace {
+	/**
+	 * Formatting the text timestamp is the most expensive part of a log line, so it is only redone when the second changes
+	 */
+	struct LogTimeStampCache {
+		time_t      time = 0;
+		std::string text;
+
+		const std::string &Get(time_t now)
+		{
+			if (text.empty() || now != time) {
+				char time_stamp[80];
+				struct tm *time_info = localtime(&now);
+				strftime(time_stamp, 80, "[%m-%d-%Y :: %H:%M:%S]", time_info);
+				time = now;
+				text = time_stamp;
+			}
+
+			return text;
+		}
+	};
+
+	struct LogRecord {
+		time_t      time;
+		uint16      debug_level;
+		uint16      log_category;
+		std::string message;
+	};
+
+	const char   binary_log_magic[8] = {'E', 'Q', 'L', 'O', 'G', 'B', 'I', 'N'};
+	const uint32 binary_log_version  = 1;
+
+	/**
+	 * @param buffer
+	 * @param value
+	 */
+	template<typename T>
+	void AppendBinary(std::string &buffer, T value)
+	{
+		buffer.append(reinterpret_cast<const char *>(&value), sizeof(value));
+	}
+
+	/**
+	 * @param buffer
+	 * @param record
+	 * @param binary
+	 * @param time_stamp_cache
+	 */
+	void AppendLogRecord(std::string &buffer, const LogRecord &record, bool binary, LogTimeStampCache &time_stamp_cache)
+	{
+		if (binary) {
+			AppendBinary<uint32>(buffer, static_cast<uint32>(record.message.length()));
+			AppendBinary<uint32>(buffer, static_cast<uint32>(record.time));
+			AppendBinary<uint16>(buffer, record.log_category);
+			AppendBinary<uint16>(buffer, record.debug_level);
+			buffer.append(record.message);
+			return;
+		}
+
+		buffer.append(time_stamp_cache.Get(record.time));
+		buffer.push_back(' ');
+		buffer.append(record.message);
+		buffer.push_back('\n');
+	}
+}
+
+/**
+ * Bounded multi producer / single consumer ring of log records drained by one writer thread
+ *
+ * Producers claim a slot with a compare and swap on the enqueue position and publish it through the
+ * slot sequence, so logging threads never take a lock. The writer batches everything available into a
+ * single write and flush.
+ */
+class EQEmuLogSys::AsyncFileWriter {
+public:
+	AsyncFileWriter(std::ofstream &&out, uint32 queue_size, bool block_when_full, bool binary)
+		: out(std::move(out)), block_when_full(block_when_full), binary(binary)
+	{
+		size_t capacity = 64;
+		while (capacity < queue_size) {
+			capacity <<= 1;
+		}
+
+		mask  = capacity - 1;
+		slots = std::unique_ptr<Slot[]>(new Slot[capacity]);
+		for (size_t i = 0; i < capacity; ++i) {
+			slots[i].sequence.store(i, std::memory_order_relaxed);
+		}
+
+		writer = std::thread(&AsyncFileWriter::Run, this);
+	}
+
+	~AsyncFileWriter()
+	{
+		running = false;
+		if (writer.joinable()) {
+			writer.join();
+		}
+	}
+
+	/**
+	 * @param debug_level
+	 * @param log_category
+	 * @param message
+	 */
+	void Push(uint16 debug_level, uint16 log_category, const std::string &message)
+	{
+		size_t pos   = enqueue_pos.load(std::memory_order_relaxed);
+		bool   waited = false;
+		Slot   *slot;
+
+		for (;;) {
+			slot = &slots[pos & mask];
+			size_t   seq  = slot->sequence.load(std::memory_order_acquire);
+			intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+			if (diff == 0) {
+				if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+					break;
+				}
+			}
+			else if (diff < 0) {
+				if (!block_when_full) {
+					dropped++;
+					return;
+				}
+
+				if (!waited) {
+					blocked++;
+					waited = true;
+				}
+
+				std::this_thread::yield();
+				pos = enqueue_pos.load(std::memory_order_relaxed);
+			}
+			else {
+				pos = enqueue_pos.load(std::memory_order_relaxed);
+			}
+		}
+
+		slot->record.time         = time(nullptr);
+		slot->record.debug_level  = debug_level;
+		slot->record.log_category = log_category;
+		slot->record.message.assign(message);
+		slot->sequence.store(pos + 1, std::memory_order_release);
+	}
+
+	/**
+	 * Waits until every line queued before the call has been written
+	 */
+	void Flush()
+	{
+		size_t target   = enqueue_pos.load(std::memory_order_acquire);
+		auto   deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+		while (written.load(std::memory_order_acquire) < target && std::chrono::steady_clock::now() < deadline) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	}
+
+	uint64 GetDropped() const { return dropped.load(); }
+	uint64 GetBlocked() const { return blocked.load(); }
+
+private:
+	struct Slot {
+		std::atomic<size_t> sequence;
+		LogRecord           record;
+	};
+
+	void Run()
+	{
+		std::string buffer;
+		for (;;) {
+			bool stopping = !running.load();
+
+			if (!Drain(buffer)) {
+				if (stopping) {
+					break;
+				}
+
+				std::this_thread::sleep_for(std::chrono::milliseconds(5));
+			}
+		}
+	}
+
+	/**
+	 * @param buffer
+	 * @return whether anything was written
+	 */
+	bool Drain(std::string &buffer)
+	{
+		buffer.clear();
+
+		uint64 dropped_now = dropped.load();
+		if (dropped_now != dropped_reported && !binary) {
+			LogRecord note;
+			note.time         = time(nullptr);
+			note.debug_level  = Logs::General;
+			note.log_category = Logs::Warning;
+			note.message      = fmt::format("[Log] [{}] file log lines dropped, writer queue full", dropped_now - dropped_reported);
+			AppendLogRecord(buffer, note, binary, time_stamp_cache);
+			dropped_reported = dropped_now;
+		}
+
+		size_t count = 0;
+		for (;;) {
+			Slot     &slot = slots[dequeue_pos & mask];
+			size_t   seq   = slot.sequence.load(std::memory_order_acquire);
+			intptr_t diff  = static_cast<intptr_t>(seq) - static_cast<intptr_t>(dequeue_pos + 1);
+			if (diff < 0) {
+				break;
+			}
+
+			AppendLogRecord(buffer, slot.record, binary, time_stamp_cache);
+			slot.sequence.store(dequeue_pos + mask + 1, std::memory_order_release);
+			dequeue_pos++;
+			count++;
+		}
+
+		if (buffer.empty()) {
+			return false;
+		}
+
+		out.write(buffer.data(), buffer.length());
+		out.flush();
+		written.fetch_add(count, std::memory_order_release);
+
+		return true;
+	}
+
+	std::ofstream                  out;
+	bool                           block_when_full;
+	bool                           binary;
+	std::unique_ptr<Slot[]>        slots;
+	size_t                         mask;
+	std::atomic<size_t>            enqueue_pos{0};
+	size_t                         dequeue_pos = 0;
+	std::atomic<size_t>            written{0};
+	std::atomic<uint64>            dropped{0};
+	std::atomic<uint64>            blocked{0};
+	uint64                         dropped_reported = 0;
+	std::atomic<bool>              running{true};
+	LogTimeStampCache              time_stamp_cache;
+	std::thread                    writer;
+};
+
 /**
  * EQEmuLogSys Constructor
  */
@@ -94,7 +341,10 @@ EQEmuLogSys::EQEmuLogSys()
 /**
  * EQEmuLogSys Deconstructor
  */
-EQEmuLogSys::~EQEmuLogSys() = default;
+EQEmuLogSys::~EQEmuLogSys()
+{
+	async_file_writer.reset();
+}
 
 void EQEmuLogSys::LoadLogSettingsDefaults()
 {
@@ -254,22 +504,53 @@ void EQEmuLogSys::ProcessLogWrite(
 	if (log_category == Logs::Crash) {
 		char time_stamp[80];
 		EQEmuLogSys::SetCurrentTimeStamp(time_stamp);
-		std::ofstream crash_log;
-		EQEmuLogSys::MakeDirectory("logs/crashes");
-		crash_log.open(
-			StringFormat("logs/crashes/crash_%s_%i.log", platform_file_name.c_str(), getpid()),
-			std::ios_base::app | std::ios_base::out
-		);
-		crash_log << time_stamp << " " << message << "\n";
-		crash_log.close();
+		if (!crash_log.is_open()) {
+			EQEmuLogSys::MakeDirectory("logs/crashes");
+			crash_log.open(
+				StringFormat("logs/crashes/crash_%s_%i.log", platform_file_name.c_str(), getpid()),
+				std::ios_base::app | std::ios_base::out
+			);
+		}
+		crash_log << time_stamp << " " << message << std::endl;
+	}
+
+	if (async_file_writer) {
+		async_file_writer->Push(debug_level, log_category, message);
+
+		/**
+		 * The process is likely on its way down, get everything ahead of the crash onto disk
+		 */
+		if (log_category == Logs::Crash) {
+			async_file_writer->Flush();
+		}
+
+		return;
+	}
+
+	if (!process_log) {
+		return;
+	}
+
+	if (binary_file_logs) {
+		static LogTimeStampCache time_stamp_cache;
+
+		LogRecord record;
+		record.time         = time(nullptr);
+		record.debug_level  = debug_level;
+		record.log_category = log_category;
+		record.message      = message;
+
+		std::string buffer;
+		AppendLogRecord(buffer, record, true, time_stamp_cache);
+		process_log.write(buffer.data(), buffer.length());
+		process_log.flush();
+		return;
 	}
 
 	char time_stamp[80];
 	EQEmuLogSys::SetCurrentTimeStamp(time_stamp);
 
-	if (process_log) {
-		process_log << time_stamp << " " << message << std::endl;
-	}
+	process_log << time_stamp << " " << message << std::endl;
 }
 
 /**
@@ -515,11 +796,53 @@ void EQEmuLogSys::MakeDirectory(const std::string &directory_name)
 
 void EQEmuLogSys::CloseFileLogs()
 {
+	/**
+	 * Stopping the writer drains whatever is still queued
+	 */
+	async_file_writer.reset();
+
 	if (process_log.is_open()) {
 		process_log.close();
 	}
 }
 
+void EQEmuLogSys::FlushFileLogs()
+{
+	if (async_file_writer) {
+		async_file_writer->Flush();
+	}
+}
+
+/**
+ * @return
+ */
+uint64 EQEmuLogSys::GetDroppedFileLogCount() const
+{
+	return async_file_writer ? async_file_writer->GetDropped() : 0;
+}
+
+/**
+ * @return
+ */
+uint64 EQEmuLogSys::GetBlockedFileLogCount() const
+{
+	return async_file_writer ? async_file_writer->GetBlocked() : 0;
+}
+
+/**
+ * @param async
+ * @param queue_size
+ * @param block_when_full
+ * @param binary
+ */
+void EQEmuLogSys::SetFileLogOptions(bool async, uint32 queue_size, bool block_when_full, bool binary)
+{
+	async_file_logs                = async;
+	async_file_log_queue_size      = queue_size;
+	async_file_log_block_when_full = block_when_full;
+	binary_file_logs               = binary;
+}
+
 /**
  * @param log_name
  */
@@ -534,6 +857,8 @@ void EQEmuLogSys::StartFileLogs(const std::string &log_name)
 		return;
 	}
 
+	std::string log_file_path;
+
 	/**
 	 * Zone
 	 */
@@ -553,13 +878,7 @@ void EQEmuLogSys::StartFileLogs(const std::string &log_name)
 		 */
 		EQEmuLogSys::MakeDirectory("logs/zone");
 
-		/**
-		 * Open file pointer
-		 */
-		process_log.open(
-			StringFormat("logs/zone/%s_%i.log", platform_file_name.c_str(), getpid()),
-			std::ios_base::app | std::ios_base::out
-		);
+		log_file_path = StringFormat("logs/zone/%s_%i", platform_file_name.c_str(), getpid());
 	}
 	else {
 
@@ -572,12 +891,45 @@ void EQEmuLogSys::StartFileLogs(const std::string &log_name)
 
 		LogInfo("Starting File Log [logs/{}_{}.log]", platform_file_name.c_str(), getpid());
 
+		log_file_path = StringFormat("logs/%s_%i", platform_file_name.c_str(), getpid());
+	}
+
+	/**
+	 * Open file pointer
+	 */
+	if (!binary_file_logs) {
+		process_log.open(log_file_path + ".log", std::ios_base::app | std::ios_base::out);
+	}
+	else {
+		log_file_path += ".bin";
+
+		std::ifstream existing(log_file_path, std::ios_base::binary | std::ios_base::ate);
+		bool          write_header = !existing.is_open() || existing.tellg() <= 0;
+		existing.close();
+
+		process_log.open(log_file_path, std::ios_base::binary | std::ios_base::app | std::ios_base::out);
+		if (process_log.is_open() && write_header) {
+			process_log.write(binary_log_magic, sizeof(binary_log_magic));
+			process_log.write(reinterpret_cast<const char *>(&binary_log_version), sizeof(binary_log_version));
+			process_log.flush();
+		}
+	}
+
+	if (!process_log.is_open()) {
+		return;
+	}
+
+	if (async_file_logs) {
 		/**
-		 * Open file pointer
+		 * The writer owns the file from here on
 		 */
-		process_log.open(
-			StringFormat("logs/%s_%i.log", platform_file_name.c_str(), getpid()),
-			std::ios_base::app | std::ios_base::out
+		async_file_writer.reset(
+			new AsyncFileWriter(
+				std::move(process_log),
+				async_file_log_queue_size,
+				async_file_log_block_when_full,
+				binary_file_logs
+			)
 		);
 	}
 }
@@ -25,6 +25,7 @@
 #include <fstream>
 #include <stdio.h>
 #include <functional>
+#include <memory>
 
 #ifdef _WIN32
 #ifdef utf16_to_utf8
@@ -190,6 +191,30 @@ namespace Logs {
 		"Aura",
 		"HotReload",
 	};
+
+	/**
+	 * Categories to compile out entirely, set through the EQEMU_LOG_DISABLED_CATEGORIES cmake option
+	 *
+	 * Ex: -DEQEMU_LOG_DISABLED_CATEGORIES="AIScanClose;PacketServerClient"
+	 */
+#ifndef EQEMU_LOG_DISABLED_CATEGORIES
+#define EQEMU_LOG_DISABLED_CATEGORIES
+#endif
+
+	static constexpr uint16 CompiledOutCategories[] = {None, EQEMU_LOG_DISABLED_CATEGORIES};
+
+	/**
+	 * Constant folds for the literal categories the Log aliases pass in
+	 *
+	 * @param log_category
+	 * @param index
+	 * @return
+	 */
+	constexpr bool IsCategoryCompiledOut(uint16 log_category, size_t index = 1)
+	{
+		return index < sizeof(CompiledOutCategories) / sizeof(CompiledOutCategories[0]) &&
+			(CompiledOutCategories[index] == log_category || IsCategoryCompiledOut(log_category, index + 1));
+	}
 }
 
 #include "eqemu_logsys_log_aliases.h"
@@ -241,6 +266,31 @@ public:
 	 */
 	void StartFileLogs(const std::string &log_name = "");
 
+	/**
+	 * Sets the file log writer options from the server config, call before StartFileLogs
+	 *
+	 * @param async
+	 * @param queue_size
+	 * @param block_when_full
+	 * @param binary
+	 */
+	void SetFileLogOptions(bool async, uint32 queue_size, bool block_when_full, bool binary);
+
+	/**
+	 * Blocks (up to a second) until the file log writer has written everything queued so far
+	 */
+	void FlushFileLogs();
+
+	/**
+	 * File log lines thrown away because the writer queue was full
+	 */
+	uint64 GetDroppedFileLogCount() const;
+
+	/**
+	 * File log lines that had to wait on the writer because the queue was full
+	 */
+	uint64 GetBlockedFileLogCount() const;
+
 	/**
      * LogSettings Struct
      *
@@ -265,8 +315,54 @@ public:
 	*/
 	LogSettings log_settings[Logs::LogCategory::MaxCategoryID]{};
 
+	/**
+	 * True when any output wants this category at this debug level
+	 *
+	 * @param debug_level
+	 * @param log_category
+	 * @return
+	 */
+	inline bool IsLogEnabled(uint16 debug_level, uint16 log_category) const
+	{
+		const LogSettings &settings = log_settings[log_category];
+
+		return settings.is_category_enabled == 1 && (
+			settings.log_to_console >= debug_level ||
+			settings.log_to_file >= debug_level ||
+			settings.log_to_gmsay >= debug_level
+		);
+	}
+
 	bool file_logs_enabled = false;
 
+	/**
+	 * File logs are handed to a writer thread through a bounded lock-free queue
+	 * instead of being formatted and flushed on the calling thread
+	 *
+	 * These are read by StartFileLogs and set through SetFileLogOptions from the
+	 * "logging" block of the server config
+	 */
+	bool async_file_logs = true;
+
+	/**
+	 * Writer queue capacity in lines, rounded up to a power of two
+	 */
+	uint32 async_file_log_queue_size = 8192;
+
+	/**
+	 * When the queue is full wait for the writer instead of dropping the line
+	 */
+	bool async_file_log_block_when_full = false;
+
+	/**
+	 * Write logs/<name>_<pid>.bin instead of the text log, decoded offline
+	 *
+	 * File header: "EQLOGBIN" followed by a uint32 format version (1)
+	 * Record:      uint32 message length, uint32 unix time, uint16 log category, uint16 debug level, message bytes
+	 * Integers are written in host byte order
+	 */
+	bool binary_file_logs = false;
+
 	/**
 	 * Sets Executable platform (Zone/World/UCS) etc.
 	 */
@@ -307,6 +403,18 @@ public:
 
 private:
 
+	class AsyncFileWriter;
+
+	/**
+	 * Running while file logs are open in async mode
+	 */
+	std::unique_ptr<AsyncFileWriter> async_file_writer;
+
+	/**
+	 * Opened the first time a crash is logged
+	 */
+	std::ofstream crash_log;
+
 	/**
 	 * Callback pointer to zone process for hooking logs to zone using GMSay
 	 */
@@ -23,47 +23,56 @@
 
 #ifdef BUILD_LOGGING
 
+/**
+ * Every alias checks this before touching its arguments, so a call site that builds packet dumps or opcode names
+ * costs nothing unless some output actually wants the category at that debug level
+ *
+ * Categories compiled out with EQEMU_LOG_DISABLED_CATEGORIES fold to false at compile time
+ */
+#define EQEMU_LOG_ENABLED(debug_level, log_category) \
+    (!Logs::IsCategoryCompiledOut(log_category) && LogSys.IsLogEnabled(debug_level, log_category))
+
 /**
  * RFC 5424
  */
 
 #define LogEmergency(message, ...) do {\
-    if (LogSys.log_settings[Logs::Emergency].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Emergency))\
         OutF(LogSys, Logs::General, Logs::Emergency, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogAlert(message, ...) do {\
-    if (LogSys.log_settings[Logs::Alert].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Alert))\
         OutF(LogSys, Logs::General, Logs::Alert, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogCritical(message, ...) do {\
-    if (LogSys.log_settings[Logs::Critical].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Critical))\
         OutF(LogSys, Logs::General, Logs::Critical, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogError(message, ...) do {\
-    if (LogSys.log_settings[Logs::Error].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Error))\
         OutF(LogSys, Logs::General, Logs::Error, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogWarning(message, ...) do {\
-    if (LogSys.log_settings[Logs::Warning].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Warning))\
         OutF(LogSys, Logs::General, Logs::Warning, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogNotice(message, ...) do {\
-    if (LogSys.log_settings[Logs::Notice].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Notice))\
         OutF(LogSys, Logs::General, Logs::Notice, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogInfo(message, ...) do {\
-    if (LogSys.log_settings[Logs::Info].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Info))\
         OutF(LogSys, Logs::General, Logs::Info, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogDebug(message, ...) do {\
-    if (LogSys.log_settings[Logs::Debug].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Debug))\
         OutF(LogSys, Logs::General, Logs::Debug, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
@@ -72,512 +81,512 @@
  */
 
 #define LogAA(message, ...) do {\
-    if (LogSys.log_settings[Logs::AA].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::AA))\
         OutF(LogSys, Logs::General, Logs::AA, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogAADetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::AA].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::AA))\
         OutF(LogSys, Logs::Detail, Logs::AA, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogAI(message, ...) do {\
-    if (LogSys.log_settings[Logs::AI].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::AI))\
         OutF(LogSys, Logs::General, Logs::AI, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogAIDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::AI].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::AI))\
         OutF(LogSys, Logs::Detail, Logs::AI, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogAggro(message, ...) do {\
-    if (LogSys.log_settings[Logs::Aggro].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Aggro))\
         OutF(LogSys, Logs::General, Logs::Aggro, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogAggroDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Aggro].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Aggro))\
         OutF(LogSys, Logs::Detail, Logs::Aggro, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogAttack(message, ...) do {\
-    if (LogSys.log_settings[Logs::Attack].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Attack))\
         OutF(LogSys, Logs::General, Logs::Attack, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogAttackDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Attack].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Attack))\
         OutF(LogSys, Logs::Detail, Logs::Attack, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogPacketClientServer(message, ...) do {\
-    if (LogSys.log_settings[Logs::PacketClientServer].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::PacketClientServer))\
         OutF(LogSys, Logs::General, Logs::PacketClientServer, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogPacketClientServerDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::PacketClientServer].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::PacketClientServer))\
         OutF(LogSys, Logs::Detail, Logs::PacketClientServer, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogCombat(message, ...) do {\
-    if (LogSys.log_settings[Logs::Combat].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Combat))\
         OutF(LogSys, Logs::General, Logs::Combat, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogCombatDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Combat].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Combat))\
         OutF(LogSys, Logs::Detail, Logs::Combat, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogCommands(message, ...) do {\
-    if (LogSys.log_settings[Logs::Commands].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Commands))\
         OutF(LogSys, Logs::General, Logs::Commands, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogCommandsDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Commands].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Commands))\
         OutF(LogSys, Logs::Detail, Logs::Commands, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogCrash(message, ...) do {\
-    if (LogSys.log_settings[Logs::Crash].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Crash))\
         OutF(LogSys, Logs::General, Logs::Crash, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogCrashDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Crash].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Crash))\
         OutF(LogSys, Logs::Detail, Logs::Crash, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogDoors(message, ...) do {\
-    if (LogSys.log_settings[Logs::Doors].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Doors))\
         OutF(LogSys, Logs::General, Logs::Doors, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogDoorsDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Doors].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Doors))\
         OutF(LogSys, Logs::Detail, Logs::Doors, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogGuilds(message, ...) do {\
-    if (LogSys.log_settings[Logs::Guilds].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Guilds))\
         OutF(LogSys, Logs::General, Logs::Guilds, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogGuildsDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Guilds].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Guilds))\
         OutF(LogSys, Logs::Detail, Logs::Guilds, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogInventory(message, ...) do {\
-    if (LogSys.log_settings[Logs::Inventory].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Inventory))\
         OutF(LogSys, Logs::General, Logs::Inventory, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogInventoryDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Inventory].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Inventory))\
         OutF(LogSys, Logs::Detail, Logs::Inventory, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogLauncher(message, ...) do {\
-    if (LogSys.log_settings[Logs::Launcher].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Launcher))\
         OutF(LogSys, Logs::General, Logs::Launcher, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogLauncherDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Launcher].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Launcher))\
         OutF(LogSys, Logs::Detail, Logs::Launcher, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogNetcode(message, ...) do {\
-    if (LogSys.log_settings[Logs::Netcode].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Netcode))\
         OutF(LogSys, Logs::General, Logs::Netcode, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogNetcodeDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Netcode].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Netcode))\
         OutF(LogSys, Logs::Detail, Logs::Netcode, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogNormal(message, ...) do {\
-    if (LogSys.log_settings[Logs::Normal].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Normal))\
         OutF(LogSys, Logs::General, Logs::Normal, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogNormalDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Normal].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Normal))\
         OutF(LogSys, Logs::Detail, Logs::Normal, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogObject(message, ...) do {\
-    if (LogSys.log_settings[Logs::Object].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Object))\
         OutF(LogSys, Logs::General, Logs::Object, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogObjectDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Object].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Object))\
         OutF(LogSys, Logs::Detail, Logs::Object, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogPathing(message, ...) do {\
-    if (LogSys.log_settings[Logs::Pathing].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Pathing))\
         OutF(LogSys, Logs::General, Logs::Pathing, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogPathingDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Pathing].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Pathing))\
         OutF(LogSys, Logs::Detail, Logs::Pathing, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogQSServer(message, ...) do {\
-    if (LogSys.log_settings[Logs::QSServer].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::QSServer))\
         OutF(LogSys, Logs::General, Logs::QSServer, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogQSServerDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::QSServer].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::QSServer))\
         OutF(LogSys, Logs::Detail, Logs::QSServer, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogQuests(message, ...) do {\
-    if (LogSys.log_settings[Logs::Quests].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Quests))\
         OutF(LogSys, Logs::General, Logs::Quests, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogQuestsDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Quests].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Quests))\
         OutF(LogSys, Logs::Detail, Logs::Quests, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogRules(message, ...) do {\
-    if (LogSys.log_settings[Logs::Rules].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Rules))\
         OutF(LogSys, Logs::General, Logs::Rules, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogRulesDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Rules].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Rules))\
         OutF(LogSys, Logs::Detail, Logs::Rules, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogSkills(message, ...) do {\
-    if (LogSys.log_settings[Logs::Skills].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Skills))\
         OutF(LogSys, Logs::General, Logs::Skills, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogSkillsDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Skills].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Skills))\
         OutF(LogSys, Logs::Detail, Logs::Skills, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogSpawns(message, ...) do {\
-    if (LogSys.log_settings[Logs::Spawns].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Spawns))\
         OutF(LogSys, Logs::General, Logs::Spawns, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogSpawnsDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Spawns].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Spawns))\
         OutF(LogSys, Logs::Detail, Logs::Spawns, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogSpells(message, ...) do {\
-    if (LogSys.log_settings[Logs::Spells].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Spells))\
         OutF(LogSys, Logs::General, Logs::Spells, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogSpellsDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Spells].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Spells))\
         OutF(LogSys, Logs::Detail, Logs::Spells, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogTCPConnection(message, ...) do {\
-    if (LogSys.log_settings[Logs::TCPConnection].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::TCPConnection))\
         OutF(LogSys, Logs::General, Logs::TCPConnection, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogTCPConnectionDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::TCPConnection].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::TCPConnection))\
         OutF(LogSys, Logs::Detail, Logs::TCPConnection, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogTasks(message, ...) do {\
-    if (LogSys.log_settings[Logs::Tasks].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Tasks))\
         OutF(LogSys, Logs::General, Logs::Tasks, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogTasksDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Tasks].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Tasks))\
         OutF(LogSys, Logs::Detail, Logs::Tasks, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogTradeskills(message, ...) do {\
-    if (LogSys.log_settings[Logs::Tradeskills].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Tradeskills))\
         OutF(LogSys, Logs::General, Logs::Tradeskills, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogTradeskillsDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Tradeskills].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Tradeskills))\
         OutF(LogSys, Logs::Detail, Logs::Tradeskills, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogTrading(message, ...) do {\
-    if (LogSys.log_settings[Logs::Trading].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Trading))\
         OutF(LogSys, Logs::General, Logs::Trading, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogTradingDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Trading].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Trading))\
         OutF(LogSys, Logs::Detail, Logs::Trading, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogTribute(message, ...) do {\
-    if (LogSys.log_settings[Logs::Tribute].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Tribute))\
         OutF(LogSys, Logs::General, Logs::Tribute, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogTributeDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Tribute].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Tribute))\
         OutF(LogSys, Logs::Detail, Logs::Tribute, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogMySQLError(message, ...) do {\
-    if (LogSys.log_settings[Logs::MySQLError].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::MySQLError))\
         OutF(LogSys, Logs::General, Logs::MySQLError, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogMySQLErrorDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::MySQLError].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::MySQLError))\
         OutF(LogSys, Logs::Detail, Logs::MySQLError, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogMySQLQuery(message, ...) do {\
-    if (LogSys.log_settings[Logs::MySQLQuery].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::MySQLQuery))\
         OutF(LogSys, Logs::General, Logs::MySQLQuery, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogMySQLQueryDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::MySQLQuery].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::MySQLQuery))\
         OutF(LogSys, Logs::Detail, Logs::MySQLQuery, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogMercenaries(message, ...) do {\
-    if (LogSys.log_settings[Logs::Mercenaries].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Mercenaries))\
         OutF(LogSys, Logs::General, Logs::Mercenaries, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogMercenariesDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Mercenaries].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Mercenaries))\
         OutF(LogSys, Logs::Detail, Logs::Mercenaries, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogQuestDebug(message, ...) do {\
-    if (LogSys.log_settings[Logs::QuestDebug].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::QuestDebug))\
         OutF(LogSys, Logs::General, Logs::QuestDebug, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogQuestDebugDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::QuestDebug].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::QuestDebug))\
         OutF(LogSys, Logs::Detail, Logs::QuestDebug, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogLoginserver(message, ...) do {\
-    if (LogSys.log_settings[Logs::Loginserver].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Loginserver))\
         OutF(LogSys, Logs::General, Logs::Loginserver, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogLoginserverDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Loginserver].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Loginserver))\
         OutF(LogSys, Logs::Detail, Logs::Loginserver, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogClientLogin(message, ...) do {\
-    if (LogSys.log_settings[Logs::ClientLogin].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::ClientLogin))\
         OutF(LogSys, Logs::General, Logs::ClientLogin, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogClientLoginDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::ClientLogin].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::ClientLogin))\
         OutF(LogSys, Logs::Detail, Logs::ClientLogin, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogHeadlessClient(message, ...) do {\
-    if (LogSys.log_settings[Logs::HeadlessClient].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::HeadlessClient))\
         OutF(LogSys, Logs::General, Logs::HeadlessClient, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogHeadlessClientDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::HeadlessClient].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::HeadlessClient))\
         OutF(LogSys, Logs::Detail, Logs::HeadlessClient, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogHPUpdate(message, ...) do {\
-    if (LogSys.log_settings[Logs::HPUpdate].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::HPUpdate))\
         OutF(LogSys, Logs::General, Logs::HPUpdate, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogHPUpdateDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::HPUpdate].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::HPUpdate))\
         OutF(LogSys, Logs::Detail, Logs::HPUpdate, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogFixZ(message, ...) do {\
-    if (LogSys.log_settings[Logs::FixZ].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::FixZ))\
         OutF(LogSys, Logs::General, Logs::FixZ, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogFixZDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::FixZ].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::FixZ))\
         OutF(LogSys, Logs::Detail, Logs::FixZ, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogFood(message, ...) do {\
-    if (LogSys.log_settings[Logs::Food].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Food))\
         OutF(LogSys, Logs::General, Logs::Food, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogFoodDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Food].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Food))\
         OutF(LogSys, Logs::Detail, Logs::Food, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogTraps(message, ...) do {\
-    if (LogSys.log_settings[Logs::Traps].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Traps))\
         OutF(LogSys, Logs::General, Logs::Traps, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogTrapsDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Traps].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Traps))\
         OutF(LogSys, Logs::Detail, Logs::Traps, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogNPCRoamBox(message, ...) do {\
-    if (LogSys.log_settings[Logs::NPCRoamBox].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::NPCRoamBox))\
         OutF(LogSys, Logs::General, Logs::NPCRoamBox, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogNPCRoamBoxDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::NPCRoamBox].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::NPCRoamBox))\
         OutF(LogSys, Logs::Detail, Logs::NPCRoamBox, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogNPCScaling(message, ...) do {\
-    if (LogSys.log_settings[Logs::NPCScaling].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::NPCScaling))\
         OutF(LogSys, Logs::General, Logs::NPCScaling, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogNPCScalingDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::NPCScaling].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::NPCScaling))\
         OutF(LogSys, Logs::Detail, Logs::NPCScaling, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogMobAppearance(message, ...) do {\
-    if (LogSys.log_settings[Logs::MobAppearance].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::MobAppearance))\
         OutF(LogSys, Logs::General, Logs::MobAppearance, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogMobAppearanceDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::MobAppearance].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::MobAppearance))\
         OutF(LogSys, Logs::Detail, Logs::MobAppearance, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogStatus(message, ...) do {\
-    if (LogSys.log_settings[Logs::Status].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Status))\
         OutF(LogSys, Logs::General, Logs::Status, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogStatusDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Status].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Status))\
         OutF(LogSys, Logs::Detail, Logs::Status, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogAIScanClose(message, ...) do {\
-    if (LogSys.log_settings[Logs::AIScanClose].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::AIScanClose))\
         OutF(LogSys, Logs::General, Logs::AIScanClose, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogAIScanCloseDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::AIScanClose].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::AIScanClose))\
         OutF(LogSys, Logs::Detail, Logs::AIScanClose, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogAIYellForHelp(message, ...) do {\
-    if (LogSys.log_settings[Logs::AIYellForHelp].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::AIYellForHelp))\
         OutF(LogSys, Logs::General, Logs::AIYellForHelp, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogAIYellForHelpDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::AIYellForHelp].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::AIYellForHelp))\
         OutF(LogSys, Logs::Detail, Logs::AIYellForHelp, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogAICastBeneficialClose(message, ...) do {\
-    if (LogSys.log_settings[Logs::AICastBeneficialClose].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::AICastBeneficialClose))\
         OutF(LogSys, Logs::General, Logs::AICastBeneficialClose, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogAICastBeneficialCloseDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::AICastBeneficialClose].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::AICastBeneficialClose))\
         OutF(LogSys, Logs::Detail, Logs::AICastBeneficialClose, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogAoeCast(message, ...) do {\
-    if (LogSys.log_settings[Logs::AoeCast].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::AoeCast))\
         OutF(LogSys, Logs::General, Logs::AoeCast, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogAoeCastDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::AoeCast].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::AoeCast))\
         OutF(LogSys, Logs::Detail, Logs::AoeCast, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogEntityManagement(message, ...) do {\
-    if (LogSys.log_settings[Logs::EntityManagement].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::EntityManagement))\
         OutF(LogSys, Logs::General, Logs::EntityManagement, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogEntityManagementDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::EntityManagement].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::EntityManagement))\
         OutF(LogSys, Logs::Detail, Logs::EntityManagement, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogFlee(message, ...) do {\
-    if (LogSys.log_settings[Logs::Flee].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Flee))\
         OutF(LogSys, Logs::General, Logs::Flee, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogFleeDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Flee].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Flee))\
         OutF(LogSys, Logs::Detail, Logs::Flee, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogAura(message, ...) do {\
-    if (LogSys.log_settings[Logs::Aura].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::Aura))\
         OutF(LogSys, Logs::General, Logs::Aura, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogAuraDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::Aura].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::Aura))\
         OutF(LogSys, Logs::Detail, Logs::Aura, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogHotReload(message, ...) do {\
-    if (LogSys.log_settings[Logs::HotReload].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::General, Logs::HotReload))\
         OutF(LogSys, Logs::General, Logs::HotReload, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogHotReloadDetail(message, ...) do {\
-    if (LogSys.log_settings[Logs::HotReload].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(Logs::Detail, Logs::HotReload))\
         OutF(LogSys, Logs::Detail, Logs::HotReload, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define Log(debug_level, log_category, message, ...) do {\
-    if (LogSys.log_settings[log_category].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(debug_level, log_category))\
         LogSys.Out(debug_level, log_category, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
 #define LogF(debug_level, log_category, message, ...) do {\
-    if (LogSys.log_settings[log_category].is_category_enabled == 1)\
+    if (EQEMU_LOG_ENABLED(debug_level, log_category))\
         OutF(LogSys, debug_level, log_category, __FILE__, __func__, __LINE__, message, ##__VA_ARGS__);\
 } while (0)
 
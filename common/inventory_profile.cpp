@@ -88,6 +88,54 @@ EQ::ItemInstance* ItemInstQueue::peek_front() const
 }
 
 
+//
+// class EQ::InventoryBucket
+//
+EQ::InventoryBucket::InventoryBucket(int16 begin, int16 end, int16 begin2, int16 end2)
+{
+	m_begin = begin;
+	m_end = end;
+	m_begin2 = begin2;
+	m_end2 = end2;
+
+	int count = 0;
+	if (m_end >= m_begin)
+		count += m_end - m_begin + 1;
+	if (m_end2 >= m_begin2)
+		count += m_end2 - m_begin2 + 1;
+
+	m_slots.reserve(count);
+	for (int16 slot_id = m_begin; slot_id <= m_end; ++slot_id)
+		m_slots.emplace_back(slot_id, nullptr);
+	for (int16 slot_id = m_begin2; slot_id <= m_end2; ++slot_id)
+		m_slots.emplace_back(slot_id, nullptr);
+}
+
+EQ::InventoryBucket::const_iterator EQ::InventoryBucket::find(int16 slot_id) const
+{
+	int index = _Index(slot_id);
+	if (index < 0 || m_slots[index].second == nullptr)
+		return cend();
+
+	return const_iterator(&m_slots[index], m_slots.data() + m_slots.size());
+}
+
+bool EQ::InventoryBucket::set(int16 slot_id, ItemInstance* inst)
+{
+	int index = _Index(slot_id);
+	if (index < 0)
+		return false;
+
+	m_slots[index].second = inst;
+	return true;
+}
+
+void EQ::InventoryBucket::clear()
+{
+	for (auto iter = m_slots.begin(); iter != m_slots.end(); ++iter)
+		iter->second = nullptr;
+}
+
 //
 // class EQ::InventoryProfile
 //
@@ -227,24 +275,8 @@ EQ::ItemInstance* EQ::InventoryProfile::GetItem(int16 slot_id, uint8 bagidx) con
 // Put an item snto specified slot
 int16 EQ::InventoryProfile::PutItem(int16 slot_id, const ItemInstance& inst)
 {
-	if (slot_id <= EQ::invslot::POSSESSIONS_END && slot_id >= EQ::invslot::POSSESSIONS_BEGIN) {
-		if ((((uint64)1 << slot_id) & m_lookup->PossessionsBitmask) == 0)
-			return EQ::invslot::SLOT_INVALID;
-	}
-	else if (slot_id <= EQ::invbag::GENERAL_BAGS_END && slot_id >= EQ::invbag::GENERAL_BAGS_BEGIN) {
-		auto temp_slot = EQ::invslot::GENERAL_BEGIN + ((slot_id - EQ::invbag::GENERAL_BAGS_BEGIN) / EQ::invbag::SLOT_COUNT);
-		if ((((uint64)1 << temp_slot) & m_lookup->PossessionsBitmask) == 0)
-			return EQ::invslot::SLOT_INVALID;
-	}
-	else if (slot_id <= EQ::invslot::BANK_END && slot_id >= EQ::invslot::BANK_BEGIN) {
-		if ((slot_id - EQ::invslot::BANK_BEGIN) >= m_lookup->InventoryTypeSize.Bank)
-			return EQ::invslot::SLOT_INVALID;
-	}
-	else if (slot_id <= EQ::invbag::BANK_BAGS_END && slot_id >= EQ::invbag::BANK_BAGS_BEGIN) {
-		auto temp_slot = (slot_id - EQ::invbag::BANK_BAGS_BEGIN) / EQ::invbag::SLOT_COUNT;
-		if (temp_slot >= m_lookup->InventoryTypeSize.Bank)
-			return EQ::invslot::SLOT_INVALID;
-	}
+	if (!_PutItemAllowed(slot_id))
+		return EQ::invslot::SLOT_INVALID;
 	
 	// Clean up item already in slot (if exists)
 	DeleteItem(slot_id);
@@ -259,8 +291,50 @@ int16 EQ::InventoryProfile::PutItem(int16 slot_id, const ItemInstance& inst)
 	return _PutItem(slot_id, inst.Clone());
 }
 
+// Put an item into specified slot without cloning it; used by bulk loads that build the instance themselves
+int16 EQ::InventoryProfile::AdoptItem(int16 slot_id, ItemInstance* inst)
+{
+	if (inst == nullptr)
+		return EQ::invslot::SLOT_INVALID;
+
+	if (!_PutItemAllowed(slot_id)) {
+		safe_delete(inst);
+		return EQ::invslot::SLOT_INVALID;
+	}
+
+	// Clean up item already in slot (if exists)
+	DeleteItem(slot_id);
+
+	if (!*inst) {
+		safe_delete(inst);
+		return slot_id;
+	}
+
+	// _PutItem() takes care of inst if the slot turns out to be invalid
+	return _PutItem(slot_id, inst);
+}
+
 int16 EQ::InventoryProfile::PushCursor(const ItemInstance &inst) {
-	m_cursor.push(inst.Clone());
+	ItemInstance* clone = inst.Clone();
+	clone->_SetOwnerSerial(m_contents_serial);
+	m_cursor.push(clone);
+
+	if (_PresenceCurrent())
+		_AddPresence(clone, invWhereCursor);
+
+	return invslot::slotCursor;
+}
+
+int16 EQ::InventoryProfile::AdoptCursorItem(ItemInstance* inst) {
+	if (inst == nullptr)
+		return EQ::invslot::SLOT_INVALID;
+
+	inst->_SetOwnerSerial(m_contents_serial);
+	m_cursor.push(inst);
+
+	if (_PresenceCurrent())
+		_AddPresence(inst, invWhereCursor);
+
 	return invslot::slotCursor;
 }
 
@@ -449,6 +523,9 @@ EQ::ItemInstance* EQ::InventoryProfile::PopItem(int16 slot_id)
 {
 	ItemInstance* p = nullptr;
 
+	// Popping out of a bag bumps the contents serial, that alone is no reason to rebuild
+	bool presence_current = _PresenceCurrent();
+
 	if (slot_id == invslot::slotCursor) {
 		p = m_cursor.pop();
 	}
@@ -484,6 +561,11 @@ EQ::ItemInstance* EQ::InventoryProfile::PopItem(int16 slot_id)
 		}
 	}
 
+	if (presence_current) {
+		m_presence_serial = *m_contents_serial;
+		_RemovePresence(p, _SlotPresence(slot_id));
+	}
+
 	// Return pointer that needs to be deleted (or otherwise managed)
 	return p;
 }
@@ -596,6 +678,11 @@ int16 EQ::InventoryProfile::HasItem(uint32 item_id, uint8 quantity, uint8 where)
 {
 	int16 slot_id = INVALID_INDEX;
 
+	// Nothing with this id anywhere we're asked to look
+	where &= _ItemPresence(item_id);
+	if (!where)
+		return slot_id;
+
 	//Altered by Father Nitwit to support a specification of
 	//where to search, with a default value to maintain compatibility
 
@@ -692,6 +779,10 @@ int16 EQ::InventoryProfile::HasItemByLoreGroup(uint32 loregroup, uint8 where)
 {
 	int16 slot_id = INVALID_INDEX;
 
+	where &= _LoreGroupPresence(loregroup);
+	if (!where)
+		return slot_id;
+
 	// Check each inventory bucket
 	if (where & invWhereWorn) {
 		slot_id = _HasItemByLoreGroup(m_worn, loregroup);
@@ -1245,7 +1336,7 @@ void EQ::InventoryProfile::dumpSharedBankItems() {
 	dumpItemCollection(m_shbank);
 }
 
-int EQ::InventoryProfile::GetSlotByItemInstCollection(const std::map<int16, ItemInstance*> &collection, ItemInstance *inst) {
+int EQ::InventoryProfile::GetSlotByItemInstCollection(const InventoryBucket &collection, ItemInstance *inst) {
 	for (auto iter = collection.begin(); iter != collection.end(); ++iter) {
 		ItemInstance *t_inst = iter->second;
 		if (t_inst == inst) {
@@ -1264,7 +1355,7 @@ int EQ::InventoryProfile::GetSlotByItemInstCollection(const std::map<int16, Item
 	return EQ::invslot::SLOT_INVALID;
 }
 
-void EQ::InventoryProfile::dumpItemCollection(const std::map<int16, ItemInstance*> &collection)
+void EQ::InventoryProfile::dumpItemCollection(const InventoryBucket &collection)
 {
 	for (auto it = collection.cbegin(); it != collection.cend(); ++it) {
 		auto inst = it->second;
@@ -1278,7 +1369,7 @@ void EQ::InventoryProfile::dumpItemCollection(const std::map<int16, ItemInstance
 	}
 }
 
-void EQ::InventoryProfile::dumpBagContents(ItemInstance *inst, std::map<int16, ItemInstance*>::const_iterator *it)
+void EQ::InventoryProfile::dumpBagContents(ItemInstance *inst, InventoryBucket::const_iterator *it)
 {
 	if (!inst || !inst->IsClassBag())
 		return;
@@ -1296,8 +1387,33 @@ void EQ::InventoryProfile::dumpBagContents(ItemInstance *inst, std::map<int16, I
 
 }
 
+// Internal Method: Checks that a slot exists for the active inventory version
+bool EQ::InventoryProfile::_PutItemAllowed(int16 slot_id) const
+{
+	if (slot_id <= EQ::invslot::POSSESSIONS_END && slot_id >= EQ::invslot::POSSESSIONS_BEGIN) {
+		if ((((uint64)1 << slot_id) & m_lookup->PossessionsBitmask) == 0)
+			return false;
+	}
+	else if (slot_id <= EQ::invbag::GENERAL_BAGS_END && slot_id >= EQ::invbag::GENERAL_BAGS_BEGIN) {
+		auto temp_slot = EQ::invslot::GENERAL_BEGIN + ((slot_id - EQ::invbag::GENERAL_BAGS_BEGIN) / EQ::invbag::SLOT_COUNT);
+		if ((((uint64)1 << temp_slot) & m_lookup->PossessionsBitmask) == 0)
+			return false;
+	}
+	else if (slot_id <= EQ::invslot::BANK_END && slot_id >= EQ::invslot::BANK_BEGIN) {
+		if ((slot_id - EQ::invslot::BANK_BEGIN) >= m_lookup->InventoryTypeSize.Bank)
+			return false;
+	}
+	else if (slot_id <= EQ::invbag::BANK_BAGS_END && slot_id >= EQ::invbag::BANK_BAGS_BEGIN) {
+		auto temp_slot = (slot_id - EQ::invbag::BANK_BAGS_BEGIN) / EQ::invbag::SLOT_COUNT;
+		if (temp_slot >= m_lookup->InventoryTypeSize.Bank)
+			return false;
+	}
+
+	return true;
+}
+
 // Internal Method: Retrieves item within an inventory bucket
-EQ::ItemInstance* EQ::InventoryProfile::_GetItem(const std::map<int16, ItemInstance*>& bucket, int16 slot_id) const
+EQ::ItemInstance* EQ::InventoryProfile::_GetItem(const InventoryBucket& bucket, int16 slot_id) const
 {
 	if (slot_id <= EQ::invslot::POSSESSIONS_END && slot_id >= EQ::invslot::POSSESSIONS_BEGIN) {
 		if ((((uint64)1 << slot_id) & m_lookup->PossessionsBitmask) == 0)
@@ -1330,6 +1446,10 @@ int16 EQ::InventoryProfile::_PutItem(int16 slot_id, ItemInstance* inst)
 		return slot_id;
 	}
 
+	// Whatever is in the slot now gets replaced without a pop, and a bag put bumps the contents serial
+	ItemInstance* replaced = GetItem(slot_id);
+	bool presence_current = _PresenceCurrent();
+
 	int16 result = INVALID_INDEX;
 	int16 parentSlot = INVALID_INDEX;
 
@@ -1341,32 +1461,32 @@ int16 EQ::InventoryProfile::_PutItem(int16 slot_id, ItemInstance* inst)
 	}
 	else if (slot_id >= invslot::EQUIPMENT_BEGIN && slot_id <= invslot::EQUIPMENT_END) {
 		if ((((uint64)1 << slot_id) & m_lookup->PossessionsBitmask) != 0) {
-			m_worn[slot_id] = inst;
+			m_worn.set(slot_id, inst);
 			result = slot_id;
 		}
 	}
 	else if ((slot_id >= invslot::GENERAL_BEGIN && slot_id <= invslot::GENERAL_END)) {
 		if ((((uint64)1 << slot_id) & m_lookup->PossessionsBitmask) != 0) {
-			m_inv[slot_id] = inst;
+			m_inv.set(slot_id, inst);
 			result = slot_id;
 		}
 	}
 	else if (slot_id >= invslot::TRIBUTE_BEGIN && slot_id <= invslot::TRIBUTE_END) {
-		m_worn[slot_id] = inst;
+		m_worn.set(slot_id, inst);
 		result = slot_id;
 	}
 	else if (slot_id >= invslot::BANK_BEGIN && slot_id <= invslot::BANK_END) {
 		if (slot_id - EQ::invslot::BANK_BEGIN < m_lookup->InventoryTypeSize.Bank) {
-			m_bank[slot_id] = inst;
+			m_bank.set(slot_id, inst);
 			result = slot_id;
 		}
 	}
 	else if (slot_id >= invslot::SHARED_BANK_BEGIN && slot_id <= invslot::SHARED_BANK_END) {
-		m_shbank[slot_id] = inst;
+		m_shbank.set(slot_id, inst);
 		result = slot_id;
 	}
 	else if (slot_id >= invslot::TRADE_BEGIN && slot_id <= invslot::TRADE_END) {
-		m_trade[slot_id] = inst;
+		m_trade.set(slot_id, inst);
 		result = slot_id;
 	}
 	else {
@@ -1384,12 +1504,23 @@ int16 EQ::InventoryProfile::_PutItem(int16 slot_id, ItemInstance* inst)
 		LogError("InventoryProfile::_PutItem: Invalid slot_id specified ({}) with parent slot id ({})", slot_id, parentSlot);
 		InventoryProfile::MarkDirty(inst); // Slot not found, clean up
 	}
+	else {
+		// Augment and bag content changes made straight on the item now invalidate our presence index
+		inst->_SetOwnerSerial(m_contents_serial);
+
+		if (presence_current) {
+			uint8 where = _SlotPresence(slot_id);
+			m_presence_serial = *m_contents_serial;
+			_RemovePresence(replaced, where);
+			_AddPresence(inst, where);
+		}
+	}
 
 	return result;
 }
 
 // Internal Method: Checks an inventory bucket for a particular item
-int16 EQ::InventoryProfile::_HasItem(std::map<int16, ItemInstance*>& bucket, uint32 item_id, uint8 quantity)
+int16 EQ::InventoryProfile::_HasItem(InventoryBucket& bucket, uint32 item_id, uint8 quantity)
 {
 	uint32 quantity_found = 0;
 
@@ -1491,7 +1622,7 @@ int16 EQ::InventoryProfile::_HasItem(ItemInstQueue& iqueue, uint32 item_id, uint
 }
 
 // Internal Method: Checks an inventory bucket for a particular item
-int16 EQ::InventoryProfile::_HasItemByUse(std::map<int16, ItemInstance*>& bucket, uint8 use, uint8 quantity)
+int16 EQ::InventoryProfile::_HasItemByUse(InventoryBucket& bucket, uint8 use, uint8 quantity)
 {
 	uint32 quantity_found = 0;
 
@@ -1566,7 +1697,7 @@ int16 EQ::InventoryProfile::_HasItemByUse(ItemInstQueue& iqueue, uint8 use, uint
 	return INVALID_INDEX;
 }
 
-int16 EQ::InventoryProfile::_HasItemByLoreGroup(std::map<int16, ItemInstance*>& bucket, uint32 loregroup)
+int16 EQ::InventoryProfile::_HasItemByLoreGroup(InventoryBucket& bucket, uint32 loregroup)
 {
 	for (auto iter = bucket.begin(); iter != bucket.end(); ++iter) {
 		if (iter->first <= EQ::invslot::POSSESSIONS_END && iter->first >= EQ::invslot::POSSESSIONS_BEGIN) {
@@ -1656,3 +1787,142 @@ int16 EQ::InventoryProfile::_HasItemByLoreGroup(ItemInstQueue& iqueue, uint32 lo
 	
 	return EQ::invslot::SLOT_INVALID;
 }
+
+// Internal Method: Rebuilds the item id and lore group counts if an item's contents changed in place since the last build
+void EQ::InventoryProfile::_UpdatePresence()
+{
+	if (_PresenceCurrent())
+		return;
+
+	m_item_presence.clear();
+	m_loregroup_presence.clear();
+	m_presence_serial = *m_contents_serial;
+
+	for (auto iter = m_worn.cbegin(); iter != m_worn.cend(); ++iter)
+		_AddPresence(iter->second, invWhereWorn);
+	for (auto iter = m_inv.cbegin(); iter != m_inv.cend(); ++iter)
+		_AddPresence(iter->second, invWherePersonal);
+	for (auto iter = m_bank.cbegin(); iter != m_bank.cend(); ++iter)
+		_AddPresence(iter->second, invWhereBank);
+	for (auto iter = m_shbank.cbegin(); iter != m_shbank.cend(); ++iter)
+		_AddPresence(iter->second, invWhereSharedBank);
+	for (auto iter = m_trade.cbegin(); iter != m_trade.cend(); ++iter)
+		_AddPresence(iter->second, invWhereTrading);
+	for (auto iter = m_cursor.cbegin(); iter != m_cursor.cend(); ++iter)
+		_AddPresence(*iter, invWhereCursor);
+}
+
+uint8 EQ::InventoryProfile::PresenceCount::Where() const
+{
+	uint8 where = 0;
+	for (int index = 0; index < 6; ++index) {
+		if (count[index])
+			where |= (1 << index);
+	}
+
+	return where;
+}
+
+// Internal Method: Counts an item, its augments and its bag contents as present in 'where'
+// This is a superset of what the _HasItem* scans will match, they still decide the slot returned
+void EQ::InventoryProfile::_AddPresence(const ItemInstance* inst, uint8 where)
+{
+	if (inst == nullptr || where == 0)
+		return;
+
+	int where_index = 0;
+	while ((where >> where_index) > 1)
+		++where_index;
+
+	_CountPresence(inst, where_index, false);
+}
+
+// Internal Method: Takes back what _AddPresence counted for an item leaving 'where'
+void EQ::InventoryProfile::_RemovePresence(const ItemInstance* inst, uint8 where)
+{
+	if (inst == nullptr || where == 0)
+		return;
+
+	int where_index = 0;
+	while ((where >> where_index) > 1)
+		++where_index;
+
+	_CountPresence(inst, where_index, true);
+}
+
+void EQ::InventoryProfile::_AdjustPresence(std::unordered_map<uint32, PresenceCount>& presence, uint32 key, int where_index, bool remove)
+{
+	if (!remove) {
+		++presence[key].count[where_index];
+		return;
+	}
+
+	auto iter = presence.find(key);
+	if (iter == presence.end())
+		return;
+
+	if (iter->second.count[where_index])
+		--iter->second.count[where_index];
+	if (iter->second.Empty())
+		presence.erase(iter);
+}
+
+void EQ::InventoryProfile::_CountPresence(const ItemInstance* inst, int where_index, bool remove)
+{
+	if (inst == nullptr)
+		return;
+
+	_AdjustPresence(m_item_presence, inst->GetID(), where_index, remove);
+	if (inst->GetItem())
+		_AdjustPresence(m_loregroup_presence, inst->GetItem()->LoreGroup, where_index, remove);
+
+	for (auto iter = inst->m_contents.cbegin(); iter != inst->m_contents.cend(); ++iter)
+		_CountPresence(iter->second, where_index, remove);
+}
+
+// Internal Method: The invWhere bucket a slot (or the bag holding it) is searched under
+uint8 EQ::InventoryProfile::_SlotPresence(int16 slot_id)
+{
+	if (slot_id == invslot::slotCursor)
+		return invWhereCursor;
+	if (slot_id >= invslot::EQUIPMENT_BEGIN && slot_id <= invslot::EQUIPMENT_END)
+		return invWhereWorn;
+	if (slot_id >= invslot::GENERAL_BEGIN && slot_id <= invslot::GENERAL_END)
+		return invWherePersonal;
+	if (slot_id >= invslot::TRIBUTE_BEGIN && slot_id <= invslot::TRIBUTE_END)
+		return invWhereWorn;
+	if (slot_id >= invslot::BANK_BEGIN && slot_id <= invslot::BANK_END)
+		return invWhereBank;
+	if (slot_id >= invslot::SHARED_BANK_BEGIN && slot_id <= invslot::SHARED_BANK_END)
+		return invWhereSharedBank;
+	if (slot_id >= invslot::TRADE_BEGIN && slot_id <= invslot::TRADE_END)
+		return invWhereTrading;
+
+	int16 parent_slot_id = CalcSlotId(slot_id);
+	if (parent_slot_id == INVALID_INDEX)
+		return 0;
+
+	return _SlotPresence(parent_slot_id);
+}
+
+uint8 EQ::InventoryProfile::_ItemPresence(uint32 item_id)
+{
+	_UpdatePresence();
+
+	auto iter = m_item_presence.find(item_id);
+	if (iter == m_item_presence.end())
+		return 0;
+
+	return iter->second.Where();
+}
+
+uint8 EQ::InventoryProfile::_LoreGroupPresence(uint32 loregroup)
+{
+	_UpdatePresence();
+
+	auto iter = m_loregroup_presence.find(loregroup);
+	if (iter == m_loregroup_presence.end())
+		return 0;
+
+	return iter->second.Where();
+}
@@ -28,6 +28,9 @@
 #include "item_instance.h"
 
 #include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 
 //FatherNitwit: location bits for searching specific
@@ -72,11 +75,80 @@ protected:
 	std::list<EQ::ItemInstance*> m_list;
 };
 
-// ########################################
-// Class: EQ::InventoryProfile
-//	Character inventory
 namespace EQ
 {
+	// ########################################
+	// Class: EQ::InventoryBucket
+	//	Flat slot storage for one inventory bucket, covering one or two contiguous slot ranges
+	//	Iterates like the map it replaced: in slot order, skipping empty slots
+	class InventoryBucket
+	{
+	public:
+		typedef std::pair<const int16, ItemInstance*> value_type;
+
+		template <typename T>
+		class Iterator
+		{
+		public:
+			Iterator(T* pos, T* end) : m_pos(pos), m_end(end) { skip(); }
+
+			T& operator*() const { return *m_pos; }
+			T* operator->() const { return m_pos; }
+			Iterator& operator++() { ++m_pos; skip(); return *this; }
+			bool operator==(const Iterator& rhs) const { return m_pos == rhs.m_pos; }
+			bool operator!=(const Iterator& rhs) const { return m_pos != rhs.m_pos; }
+
+		private:
+			void skip() { while (m_pos != m_end && m_pos->second == nullptr) { ++m_pos; } }
+
+			T* m_pos;
+			T* m_end;
+		};
+
+		typedef Iterator<value_type> iterator;
+		typedef Iterator<const value_type> const_iterator;
+
+		InventoryBucket(int16 begin, int16 end, int16 begin2 = 0, int16 end2 = -1);
+
+		inline iterator begin() { return iterator(m_slots.data(), m_slots.data() + m_slots.size()); }
+		inline iterator end() { return iterator(m_slots.data() + m_slots.size(), m_slots.data() + m_slots.size()); }
+		inline const_iterator begin() const { return cbegin(); }
+		inline const_iterator end() const { return cend(); }
+		inline const_iterator cbegin() const { return const_iterator(m_slots.data(), m_slots.data() + m_slots.size()); }
+		inline const_iterator cend() const { return const_iterator(m_slots.data() + m_slots.size(), m_slots.data() + m_slots.size()); }
+
+		// Returns end() for an empty slot or one outside of the bucket
+		const_iterator find(int16 slot_id) const;
+
+		// Returns nullptr for an empty slot or one outside of the bucket
+		inline ItemInstance* operator[](int16 slot_id) const { int index = _Index(slot_id); return (index < 0) ? nullptr : m_slots[index].second; }
+
+		// Returns false if slot_id is outside of the bucket
+		bool set(int16 slot_id, ItemInstance* inst);
+		inline void erase(int16 slot_id) { set(slot_id, nullptr); }
+
+		// Empties every slot without memory delete
+		void clear();
+
+	protected:
+		inline int _Index(int16 slot_id) const {
+			if (slot_id >= m_begin && slot_id <= m_end)
+				return slot_id - m_begin;
+			if (slot_id >= m_begin2 && slot_id <= m_end2)
+				return (m_end - m_begin + 1) + (slot_id - m_begin2);
+			return -1;
+		}
+
+		int16 m_begin;
+		int16 m_end;
+		int16 m_begin2;
+		int16 m_end2;
+		std::vector<value_type> m_slots;
+	};
+
+	// ########################################
+	// Class: EQ::InventoryProfile
+	//	Character inventory
 	class InventoryProfile
 	{
 		friend class ItemInstance;
@@ -85,7 +157,15 @@ namespace EQ
 		// Public Methods
 		///////////////////////////////
 
-		InventoryProfile() {
+		InventoryProfile() :
+			m_worn(invslot::EQUIPMENT_BEGIN, invslot::EQUIPMENT_END, invslot::TRIBUTE_BEGIN, invslot::TRIBUTE_END),
+			m_inv(invslot::GENERAL_BEGIN, invslot::GENERAL_END),
+			m_bank(invslot::BANK_BEGIN, invslot::BANK_END),
+			m_shbank(invslot::SHARED_BANK_BEGIN, invslot::SHARED_BANK_END),
+			m_trade(invslot::TRADE_BEGIN, invslot::TRADE_END)
+		{
+			m_presence_serial = 0;
+			m_contents_serial = std::make_shared<uint32>(0);
 			m_mob_version = versions::MobVersion::Unknown;
 			m_gm_inventory = false;
 			m_lookup = inventory::StaticLookup(versions::MobVersion::Unknown);
@@ -121,8 +201,13 @@ namespace EQ
 		// Add item to inventory
 		int16 PutItem(int16 slot_id, const ItemInstance& inst);
 
+		// Add item to inventory, taking ownership of inst instead of cloning it
+		// inst is released if it can't be placed
+		int16 AdoptItem(int16 slot_id, ItemInstance* inst);
+
 		// Add item to cursor queue
 		int16 PushCursor(const ItemInstance& inst);
+		int16 AdoptCursorItem(ItemInstance* inst);
 
 		// Get cursor item in front of queue
 		ItemInstance* GetCursorItem();
@@ -155,6 +240,11 @@ namespace EQ
 		// where argument specifies OR'd list of invWhere constants to look
 		int16 HasItemByLoreGroup(uint32 loregroup, uint8 where = 0xFF);
 
+		// OR'd invWhere constants the item id or lore group is held in, items in slots the
+		// inventory version doesn't allow included; a zero means HasItem* won't find it
+		uint8 GetItemPresence(uint32 item_id) { return _ItemPresence(item_id); }
+		uint8 GetLoreGroupPresence(uint32 loregroup) { return _LoreGroupPresence(loregroup); }
+
 		// Locate an available inventory slot
 		int16 FindFreeSlot(bool for_bag, bool try_cursor, uint8 min_size = 0, bool is_arrow = false);
 		int16 FindFreeSlotForTradeItem(const ItemInstance* inst, int16 general_start = invslot::GENERAL_BEGIN, uint8 bag_start = invbag::SLOT_BEGIN);
@@ -195,32 +285,61 @@ namespace EQ
 		// Protected Methods
 		///////////////////////////////
 
-		int GetSlotByItemInstCollection(const std::map<int16, ItemInstance*> &collection, ItemInstance *inst);
-		void dumpItemCollection(const std::map<int16, ItemInstance*> &collection);
-		void dumpBagContents(ItemInstance *inst, std::map<int16, ItemInstance*>::const_iterator *it);
+		int GetSlotByItemInstCollection(const InventoryBucket &collection, ItemInstance *inst);
+		void dumpItemCollection(const InventoryBucket &collection);
+		void dumpBagContents(ItemInstance *inst, InventoryBucket::const_iterator *it);
 
 		// Retrieves item within an inventory bucket
-		ItemInstance* _GetItem(const std::map<int16, ItemInstance*>& bucket, int16 slot_id) const;
+		ItemInstance* _GetItem(const InventoryBucket& bucket, int16 slot_id) const;
+
+		// Checks the slot against the active inventory version before a put
+		bool _PutItemAllowed(int16 slot_id) const;
 
 		// Private "put" item into bucket, without regard for what is currently in bucket
 		int16 _PutItem(int16 slot_id, ItemInstance* inst);
 
 		// Checks an inventory bucket for a particular item
-		int16 _HasItem(std::map<int16, ItemInstance*>& bucket, uint32 item_id, uint8 quantity);
+		int16 _HasItem(InventoryBucket& bucket, uint32 item_id, uint8 quantity);
 		int16 _HasItem(ItemInstQueue& iqueue, uint32 item_id, uint8 quantity);
-		int16 _HasItemByUse(std::map<int16, ItemInstance*>& bucket, uint8 use, uint8 quantity);
+		int16 _HasItemByUse(InventoryBucket& bucket, uint8 use, uint8 quantity);
 		int16 _HasItemByUse(ItemInstQueue& iqueue, uint8 use, uint8 quantity);
-		int16 _HasItemByLoreGroup(std::map<int16, ItemInstance*>& bucket, uint32 loregroup);
+		int16 _HasItemByLoreGroup(InventoryBucket& bucket, uint32 loregroup);
 		int16 _HasItemByLoreGroup(ItemInstQueue& iqueue, uint32 loregroup);
 
+		// Item id and lore group counts, one per invWhere bit
+		// Kept up to date by the put and pop paths, rebuilt only after an item's contents changed in place
+		struct PresenceCount {
+			PresenceCount() { for (int index = 0; index < 6; ++index) { count[index] = 0; } }
+
+			uint8 Where() const;
+			bool Empty() const { return Where() == 0; }
+
+			uint16 count[6];
+		};
+
+		bool _PresenceCurrent() const { return m_presence_serial == *m_contents_serial; }
+		void _UpdatePresence();
+		void _AddPresence(const ItemInstance* inst, uint8 where);
+		void _RemovePresence(const ItemInstance* inst, uint8 where);
+		void _CountPresence(const ItemInstance* inst, int where_index, bool remove);
+		static void _AdjustPresence(std::unordered_map<uint32, PresenceCount>& presence, uint32 key, int where_index, bool remove);
+		static uint8 _SlotPresence(int16 slot_id);
+		uint8 _ItemPresence(uint32 item_id);
+		uint8 _LoreGroupPresence(uint32 loregroup);
+
 
 		// Player inventory
-		std::map<int16, ItemInstance*>	m_worn;		// Items worn by character
-		std::map<int16, ItemInstance*>	m_inv;		// Items in character personal inventory
-		std::map<int16, ItemInstance*>	m_bank;		// Items in character bank
-		std::map<int16, ItemInstance*>	m_shbank;	// Items in character shared bank
-		std::map<int16, ItemInstance*>	m_trade;	// Items in a trade session
-		::ItemInstQueue					m_cursor;	// Items on cursor: FIFO
+		InventoryBucket		m_worn;		// Items worn by character
+		InventoryBucket		m_inv;		// Items in character personal inventory
+		InventoryBucket		m_bank;		// Items in character bank
+		InventoryBucket		m_shbank;	// Items in character shared bank
+		InventoryBucket		m_trade;	// Items in a trade session
+		::ItemInstQueue		m_cursor;	// Items on cursor: FIFO
+
+		uint32										m_presence_serial;	// m_contents_serial the counts were last in step with
+		std::shared_ptr<uint32>						m_contents_serial;	// Bumped by items held here when their contents change
+		std::unordered_map<uint32, PresenceCount>	m_item_presence;
+		std::unordered_map<uint32, PresenceCount>	m_loregroup_presence;
 
 	private:
 		// Active mob version
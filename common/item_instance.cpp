@@ -364,6 +364,25 @@ void EQ::ItemInstance::PutItem(uint8 index, const ItemInstance& inst)
 	_PutItem(index, inst.Clone());
 }
 
+// Internal Method: "put" item into container, the item joins whatever profile holds this one
+void EQ::ItemInstance::_PutItem(uint8 index, ItemInstance* inst)
+{
+	m_contents[index] = inst;
+	if (inst)
+		inst->_SetOwnerSerial(m_owner_serial);
+
+	_ContentsChanged();
+}
+
+void EQ::ItemInstance::_SetOwnerSerial(const std::shared_ptr<uint32>& owner_serial)
+{
+	m_owner_serial = owner_serial;
+	for (auto iter = m_contents.begin(); iter != m_contents.end(); ++iter) {
+		if (iter->second)
+			iter->second->_SetOwnerSerial(owner_serial);
+	}
+}
+
 // Remove item inside container
 void EQ::ItemInstance::DeleteItem(uint8 index)
 {
@@ -379,6 +398,7 @@ EQ::ItemInstance* EQ::ItemInstance::PopItem(uint8 index)
 	if (iter != m_contents.end()) {
 		ItemInstance* inst = iter->second;
 		m_contents.erase(index);
+		_ContentsChanged();
 		return inst; // Return pointer that needs to be deleted (or otherwise managed)
 	}
 	
@@ -388,11 +408,15 @@ EQ::ItemInstance* EQ::ItemInstance::PopItem(uint8 index)
 // Remove all items from container
 void EQ::ItemInstance::Clear()
 {
+	if (m_contents.empty())
+		return;
+
 	// Destroy container contents
 	for (auto iter = m_contents.begin(); iter != m_contents.end(); ++iter) {
 		safe_delete(iter->second);
 	}
 	m_contents.clear();
+	_ContentsChanged();
 }
 
 // Remove all items from container
@@ -400,6 +424,8 @@ void EQ::ItemInstance::ClearByFlags(byFlagSetting is_nodrop, byFlagSetting is_no
 {
 	// TODO: This needs work...
 
+	_ContentsChanged();
+
 	// Destroy container contents
 	std::map<uint8, ItemInstance*>::const_iterator cur, end, del;
 	cur = m_contents.begin();
@@ -650,12 +676,14 @@ void EQ::ItemInstance::PutAugment(SharedDatabase *db, uint8 slot, uint32 item_id
 {
 	if (item_id == 0) { return; }
 	if (db == nullptr) { return; /* TODO: add log message for nullptr */ }
+	if (!m_item || !m_item->IsClassCommon()) { return; }
 
-	const ItemInstance* aug = db->CreateItem(item_id);
+	// the augment is built for this slot, hand it over rather than cloning it
+	ItemInstance* aug = db->CreateItem(item_id);
 	if (aug) {
-		PutAugment(slot, *aug);
-		safe_delete(aug);
-	}	
+		DeleteItem(slot);
+		_PutItem(slot, aug);
+	}
 }
 
 // Remove augment from item and destroy it
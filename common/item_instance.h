@@ -36,6 +36,7 @@ class EvolveInfo;			// Stores information about an evolving item family
 #include "../common/memory_buffer.h"
 
 #include <map>
+#include <memory>
 
 
 // Specifies usage type for item inside EQ::ItemInstance
@@ -288,7 +289,14 @@ namespace EQ
 		std::map<uint8, ItemInstance*>::const_iterator _cbegin() { return m_contents.cbegin(); }
 		std::map<uint8, ItemInstance*>::const_iterator _cend() { return m_contents.cend(); }
 
-		void _PutItem(uint8 index, ItemInstance* inst) { m_contents[index] = inst; }
+		void _PutItem(uint8 index, ItemInstance* inst);
+
+		// Hooks this item and its contents up to the contents serial of the profile holding it
+		void _SetOwnerSerial(const std::shared_ptr<uint32>& owner_serial);
+		void _ContentsChanged() { if (m_owner_serial) { ++(*m_owner_serial); } }
+
+		// Bumped when this item's contents (bag items, augments) change, null while not in a profile
+		std::shared_ptr<uint32> m_owner_serial;
 
 		ItemInstTypes		m_use_type;	// Usage type for item
 		const ItemData*		m_item;		// Ptr to item data
@@ -0,0 +1,314 @@
+#include "mysql_stmt.h"
+
+#include <memory>
+#include <stdlib.h>
+#include <string.h>
+
+// strings longer than this are pulled with mysql_stmt_fetch_column after the fetch
+#define MYSQL_STMT_STRING_BUFFER 256
+
+MySQLStmtParams& MySQLStmtParams::AddParam(enum_field_types type, bool is_unsigned, int64 i, double d)
+{
+	Param param;
+	param.type = type;
+	param.is_unsigned = is_unsigned;
+	param.i = i;
+	param.d = d;
+	m_Params.push_back(param);
+	return *this;
+}
+
+MySQLStmtParams& MySQLStmtParams::Add(int32 value)
+{
+	return AddParam(MYSQL_TYPE_LONGLONG, false, value, 0.0);
+}
+
+MySQLStmtParams& MySQLStmtParams::Add(uint32 value)
+{
+	return AddParam(MYSQL_TYPE_LONGLONG, true, value, 0.0);
+}
+
+MySQLStmtParams& MySQLStmtParams::Add(int64 value)
+{
+	return AddParam(MYSQL_TYPE_LONGLONG, false, value, 0.0);
+}
+
+MySQLStmtParams& MySQLStmtParams::Add(uint64 value)
+{
+	return AddParam(MYSQL_TYPE_LONGLONG, true, static_cast<int64>(value), 0.0);
+}
+
+MySQLStmtParams& MySQLStmtParams::Add(double value)
+{
+	return AddParam(MYSQL_TYPE_DOUBLE, false, 0, value);
+}
+
+MySQLStmtParams& MySQLStmtParams::Add(const std::string &value)
+{
+	AddParam(MYSQL_TYPE_STRING, false, 0, 0.0);
+	m_Params.back().s = value;
+	return *this;
+}
+
+MySQLStmtParams& MySQLStmtParams::Add(const char *value)
+{
+	if (value == nullptr)
+		return AddNull();
+
+	return Add(std::string(value));
+}
+
+MySQLStmtParams& MySQLStmtParams::AddNull()
+{
+	return AddParam(MYSQL_TYPE_NULL, false, 0, 0.0);
+}
+
+void MySQLStmtParams::Bind(std::vector<MYSQL_BIND> &binds) const
+{
+	binds.resize(m_Params.size());
+	if (binds.empty())
+		return;
+
+	memset(&binds[0], 0, sizeof(MYSQL_BIND) * binds.size());
+
+	// input buffers are only read by the client library
+	for (size_t i = 0; i < m_Params.size(); ++i) {
+		const Param &param = m_Params[i];
+		MYSQL_BIND &bind = binds[i];
+
+		bind.buffer_type = param.type;
+		switch (param.type) {
+		case MYSQL_TYPE_LONGLONG:
+			bind.buffer = const_cast<int64*>(&param.i);
+			bind.is_unsigned = param.is_unsigned;
+			break;
+		case MYSQL_TYPE_DOUBLE:
+			bind.buffer = const_cast<double*>(&param.d);
+			break;
+		case MYSQL_TYPE_STRING:
+			// with no length pointer buffer_length is taken as the data length
+			bind.buffer = const_cast<char*>(param.s.data());
+			bind.buffer_length = static_cast<unsigned long>(param.s.length());
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+int64 MySQLStmtRow::GetInt64(int column) const
+{
+	const Value &value = m_Values[column];
+	switch (value.type) {
+	case Int:
+		return value.i;
+	case UInt:
+		return static_cast<int64>(value.u);
+	case Double:
+		return static_cast<int64>(value.d);
+	case String:
+		return strtoll(value.s.c_str(), nullptr, 10);
+	default:
+		return 0;
+	}
+}
+
+double MySQLStmtRow::GetDouble(int column) const
+{
+	const Value &value = m_Values[column];
+	switch (value.type) {
+	case Int:
+		return static_cast<double>(value.i);
+	case UInt:
+		return static_cast<double>(value.u);
+	case Double:
+		return value.d;
+	case String:
+		return strtod(value.s.c_str(), nullptr);
+	default:
+		return 0.0;
+	}
+}
+
+std::string MySQLStmtRow::GetString(int column) const
+{
+	const Value &value = m_Values[column];
+	switch (value.type) {
+	case Int:
+		return std::to_string(value.i);
+	case UInt:
+		return std::to_string(value.u);
+	case Double:
+		return std::to_string(value.d);
+	case String:
+		return value.s;
+	default:
+		return std::string();
+	}
+}
+
+MySQLStmtResult::MySQLStmtResult(uint32 errorNumber, const std::string &errorMessage)
+{
+	m_Success = false;
+	m_ErrorNumber = errorNumber;
+	m_ErrorMessage = errorMessage;
+	m_RowsAffected = 0;
+	m_ColumnCount = 0;
+	m_LastInsertedID = 0;
+}
+
+MySQLStmtResult::MySQLStmtResult(MYSQL_STMT *stmt)
+{
+	m_Success = true;
+	m_ErrorNumber = 0;
+	m_RowsAffected = 0;
+	m_ColumnCount = 0;
+	m_LastInsertedID = 0;
+
+	Fetch(stmt);
+}
+
+void MySQLStmtResult::SetError(MYSQL_STMT *stmt)
+{
+	m_Success = false;
+	m_ErrorNumber = mysql_stmt_errno(stmt);
+	m_ErrorMessage = "#" + std::to_string(m_ErrorNumber) + ": " + mysql_stmt_error(stmt);
+	m_Rows.clear();
+}
+
+// Pulls the whole result set of an executed statement into rows
+void MySQLStmtResult::Fetch(MYSQL_STMT *stmt)
+{
+	MYSQL_RES *meta = mysql_stmt_result_metadata(stmt);
+	if (meta == nullptr) {
+		// no result set (insert, update, delete...)
+		m_RowsAffected = static_cast<uint32>(mysql_stmt_affected_rows(stmt));
+		m_LastInsertedID = static_cast<uint32>(mysql_stmt_insert_id(stmt));
+		return;
+	}
+
+	m_ColumnCount = mysql_num_fields(meta);
+	MYSQL_FIELD *fields = mysql_fetch_fields(meta);
+
+	if (mysql_stmt_store_result(stmt) != 0) {
+		SetError(stmt);
+		mysql_stmt_free_result(stmt);
+		mysql_free_result(meta);
+		return;
+	}
+
+	// only meaningful once buffered, it's the row count for a select like QueryDatabase's
+	m_RowsAffected = static_cast<uint32>(mysql_stmt_affected_rows(stmt));
+
+	std::vector<MYSQL_BIND> binds(m_ColumnCount);
+	std::vector<MySQLStmtRow::ValueType> types(m_ColumnCount);
+	std::vector<int64> ints(m_ColumnCount);
+	std::vector<double> doubles(m_ColumnCount);
+	std::vector<std::vector<char>> strings(m_ColumnCount);
+	std::vector<unsigned long> lengths(m_ColumnCount);
+	// not std::vector, MySQLBindBool is plain bool on MySQL 8
+	std::unique_ptr<MySQLBindBool[]> nulls(new MySQLBindBool[m_ColumnCount]());
+	std::unique_ptr<MySQLBindBool[]> errors(new MySQLBindBool[m_ColumnCount]());
+
+	if (m_ColumnCount > 0)
+		memset(&binds[0], 0, sizeof(MYSQL_BIND) * m_ColumnCount);
+
+	for (uint32 i = 0; i < m_ColumnCount; ++i) {
+		MYSQL_BIND &bind = binds[i];
+		bind.length = &lengths[i];
+		bind.is_null = &nulls[i];
+		bind.error = &errors[i];
+
+		switch (fields[i].type) {
+		case MYSQL_TYPE_TINY:
+		case MYSQL_TYPE_SHORT:
+		case MYSQL_TYPE_INT24:
+		case MYSQL_TYPE_LONG:
+		case MYSQL_TYPE_LONGLONG:
+		case MYSQL_TYPE_YEAR:
+			types[i] = (fields[i].flags & UNSIGNED_FLAG) ? MySQLStmtRow::UInt : MySQLStmtRow::Int;
+			bind.buffer_type = MYSQL_TYPE_LONGLONG;
+			bind.buffer = &ints[i];
+			bind.is_unsigned = (fields[i].flags & UNSIGNED_FLAG) ? 1 : 0;
+			break;
+		case MYSQL_TYPE_FLOAT:
+		case MYSQL_TYPE_DOUBLE:
+			types[i] = MySQLStmtRow::Double;
+			bind.buffer_type = MYSQL_TYPE_DOUBLE;
+			bind.buffer = &doubles[i];
+			break;
+		default:
+			// decimals, temporals and text come back as strings like they do for QueryDatabase
+			types[i] = MySQLStmtRow::String;
+			strings[i].resize(MYSQL_STMT_STRING_BUFFER);
+			bind.buffer_type = MYSQL_TYPE_STRING;
+			bind.buffer = &strings[i][0];
+			bind.buffer_length = MYSQL_STMT_STRING_BUFFER;
+			break;
+		}
+	}
+
+	if (m_ColumnCount > 0 && mysql_stmt_bind_result(stmt, &binds[0]) != 0) {
+		SetError(stmt);
+		mysql_stmt_free_result(stmt);
+		mysql_free_result(meta);
+		return;
+	}
+
+	m_Rows.reserve(static_cast<size_t>(mysql_stmt_num_rows(stmt)));
+
+	while (true) {
+		int status = mysql_stmt_fetch(stmt);
+		if (status == MYSQL_NO_DATA)
+			break;
+
+		if (status == 1) {
+			SetError(stmt);
+			break;
+		}
+
+		MySQLStmtRow row;
+		row.m_Values.resize(m_ColumnCount);
+
+		for (uint32 i = 0; i < m_ColumnCount; ++i) {
+			if (nulls[i])
+				continue;
+
+			MySQLStmtRow::Value &value = row.m_Values[i];
+			value.type = types[i];
+
+			switch (types[i]) {
+			case MySQLStmtRow::Int:
+				value.i = ints[i];
+				break;
+			case MySQLStmtRow::UInt:
+				value.u = static_cast<uint64>(ints[i]);
+				break;
+			case MySQLStmtRow::Double:
+				value.d = doubles[i];
+				break;
+			default:
+				if (lengths[i] > MYSQL_STMT_STRING_BUFFER) {
+					// MYSQL_DATA_TRUNCATED, go back for the rest of it
+					value.s.resize(lengths[i]);
+
+					MYSQL_BIND column;
+					memset(&column, 0, sizeof(column));
+					column.buffer_type = MYSQL_TYPE_STRING;
+					column.buffer = &value.s[0];
+					column.buffer_length = lengths[i];
+					mysql_stmt_fetch_column(stmt, &column, i, 0);
+				}
+				else {
+					value.s.assign(&strings[i][0], lengths[i]);
+				}
+				break;
+			}
+		}
+
+		m_Rows.push_back(std::move(row));
+	}
+
+	mysql_stmt_free_result(stmt);
+	mysql_free_result(meta);
+}
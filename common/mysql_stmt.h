@@ -0,0 +1,112 @@
+#ifndef MYSQL_STMT_H
+#define MYSQL_STMT_H
+
+#ifdef _WINDOWS
+	#include <winsock2.h>
+	#include <windows.h>
+#endif
+
+#include <mysql.h>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "types.h"
+
+// MySQL 8 dropped my_bool, use whatever MYSQL_BIND points its flags at
+typedef std::remove_pointer<decltype(MYSQL_BIND::is_null)>::type MySQLBindBool;
+
+// Parameters for a prepared statement, bound in the order they are added
+class MySQLStmtParams {
+public:
+	MySQLStmtParams& Add(int32 value);
+	MySQLStmtParams& Add(uint32 value);
+	MySQLStmtParams& Add(int64 value);
+	MySQLStmtParams& Add(uint64 value);
+	MySQLStmtParams& Add(double value);
+	MySQLStmtParams& Add(const std::string &value);
+	MySQLStmtParams& Add(const char *value);
+	MySQLStmtParams& AddNull();
+
+	size_t Count() const { return m_Params.size(); }
+
+	// binds point into this object, it has to outlive the execute
+	void Bind(std::vector<MYSQL_BIND> &binds) const;
+
+private:
+	struct Param {
+		enum_field_types type;
+		bool is_unsigned;
+		int64 i;
+		double d;
+		std::string s;
+	};
+
+	MySQLStmtParams& AddParam(enum_field_types type, bool is_unsigned, int64 i, double d);
+
+	std::vector<Param> m_Params;
+};
+
+// One fetched row, values are kept in their binary form and converted on access
+class MySQLStmtRow {
+public:
+	bool IsNull(int column) const { return m_Values[column].type == Null; }
+
+	int64 GetInt64(int column) const;
+	uint64 GetUInt64(int column) const { return static_cast<uint64>(GetInt64(column)); }
+	int32 GetInt32(int column) const { return static_cast<int32>(GetInt64(column)); }
+	uint32 GetUInt32(int column) const { return static_cast<uint32>(GetInt64(column)); }
+	double GetDouble(int column) const;
+	float GetFloat(int column) const { return static_cast<float>(GetDouble(column)); }
+	std::string GetString(int column) const;
+
+private:
+	friend class MySQLStmtResult;
+
+	enum ValueType { Null, Int, UInt, Double, String };
+
+	struct Value {
+		ValueType type;
+		union {
+			int64 i;
+			uint64 u;
+			double d;
+		};
+		std::string s;
+
+		Value() : type(Null), i(0) { }
+	};
+
+	std::vector<Value> m_Values;
+};
+
+// Result of a prepared statement, rows are fully fetched so the statement can be reused right away
+class MySQLStmtResult {
+public:
+	MySQLStmtResult(uint32 errorNumber, const std::string &errorMessage);
+	MySQLStmtResult(MYSQL_STMT *stmt);
+
+	bool Success() const { return m_Success; }
+	std::string ErrorMessage() const { return m_ErrorMessage; }
+	uint32 ErrorNumber() const { return m_ErrorNumber; }
+	uint32 RowsAffected() const { return m_RowsAffected; }
+	uint32 RowCount() const { return static_cast<uint32>(m_Rows.size()); }
+	uint32 ColumnCount() const { return m_ColumnCount; }
+	uint32 LastInsertedID() const { return m_LastInsertedID; }
+
+	std::vector<MySQLStmtRow>::const_iterator begin() const { return m_Rows.cbegin(); }
+	std::vector<MySQLStmtRow>::const_iterator end() const { return m_Rows.cend(); }
+
+private:
+	void Fetch(MYSQL_STMT *stmt);
+	void SetError(MYSQL_STMT *stmt);
+
+	bool m_Success;
+	uint32 m_ErrorNumber;
+	std::string m_ErrorMessage;
+	uint32 m_RowsAffected;
+	uint32 m_ColumnCount;
+	uint32 m_LastInsertedID;
+	std::vector<MySQLStmtRow> m_Rows;
+};
+
+#endif
@@ -1,14 +1,100 @@
 #include "tcp_connection.h"
 #include "../event/event_loop.h"
+#include <algorithm>
 
 void on_close_handle(uv_handle_t* handle) {
 	delete handle;
 }
 
+namespace {
+	const size_t WriteChunkSize = 16384;
+	const size_t MaxPendingWriteBytes = 262144;
+	const size_t MaxPooledWriteChunks = 64;
+	const size_t MaxPooledWriteBatons = 32;
+
+	struct WriteBaton
+	{
+		uv_write_t req;
+		EQ::Net::TCPConnection *connection;
+		std::vector<std::vector<char>> chunks;
+		std::vector<uv_buf_t> buffers;
+	};
+
+	// pools are per loop thread, a baton can outlive the connection that sent it
+	std::vector<std::vector<char>> &WriteChunkPool() {
+		static thread_local std::vector<std::vector<char>> pool;
+		return pool;
+	}
+
+	std::vector<std::unique_ptr<WriteBaton>> &WriteBatonPool() {
+		static thread_local std::vector<std::unique_ptr<WriteBaton>> pool;
+		return pool;
+	}
+
+	std::vector<char> AcquireWriteChunk() {
+		auto &pool = WriteChunkPool();
+		if (!pool.empty()) {
+			std::vector<char> chunk = std::move(pool.back());
+			pool.pop_back();
+			return chunk;
+		}
+
+		std::vector<char> chunk;
+		chunk.reserve(WriteChunkSize);
+		return chunk;
+	}
+
+	void ReleaseWriteChunk(std::vector<char> &chunk) {
+		auto &pool = WriteChunkPool();
+		if (pool.size() < MaxPooledWriteChunks) {
+			chunk.clear();
+			pool.push_back(std::move(chunk));
+		}
+	}
+
+	WriteBaton *AcquireWriteBaton() {
+		auto &pool = WriteBatonPool();
+		if (!pool.empty()) {
+			WriteBaton *baton = pool.back().release();
+			pool.pop_back();
+			return baton;
+		}
+
+		return new WriteBaton;
+	}
+
+	void ReleaseWriteBaton(WriteBaton *baton) {
+		for (auto &chunk : baton->chunks) {
+			ReleaseWriteChunk(chunk);
+		}
+		baton->chunks.clear();
+		baton->buffers.clear();
+		baton->connection = nullptr;
+
+		auto &pool = WriteBatonPool();
+		if (pool.size() < MaxPooledWriteBatons) {
+			pool.push_back(std::unique_ptr<WriteBaton>(baton));
+		}
+		else {
+			delete baton;
+		}
+	}
+}
+
 EQ::Net::TCPConnection::TCPConnection(uv_tcp_t *socket)
 {
 	m_socket = socket;
 	m_socket->data = this;
+	m_flush_prepare = nullptr;
+	m_flush_check = nullptr;
+	m_flush_queued = false;
+	m_pending_bytes = 0;
+	m_stats = TCPConnectionStats{};
+	m_rate_second = 0;
+	m_rate_bytes = 0;
+	m_rate_writes = 0;
+	m_last_bytes_per_second = 0;
+	m_last_writes_per_second = 0;
 }
 
 EQ::Net::TCPConnection::~TCPConnection() {
@@ -106,6 +192,27 @@ void EQ::Net::TCPConnection::OnDisconnect(std::function<void(TCPConnection*)> cb
 
 void EQ::Net::TCPConnection::Disconnect()
 {
+	if (m_socket) {
+		// hand what we have to libuv first, same as when every Write went straight out
+		Flush();
+	}
+
+	StopFlush();
+
+	if (m_flush_prepare) {
+		uv_close((uv_handle_t*)m_flush_prepare, [](uv_handle_t* handle) {
+			delete (uv_prepare_t*)handle;
+		});
+		m_flush_prepare = nullptr;
+	}
+
+	if (m_flush_check) {
+		uv_close((uv_handle_t*)m_flush_check, [](uv_handle_t* handle) {
+			delete (uv_check_t*)handle;
+		});
+		m_flush_check = nullptr;
+	}
+
 	if (m_socket) {
 		m_socket->data = this;
 		uv_close((uv_handle_t*)m_socket, [](uv_handle_t* handle) {
@@ -134,35 +241,161 @@ void EQ::Net::TCPConnection::Write(const char *data, size_t count)
 		return;
 	}
 
-	struct WriteBaton
-	{
-		TCPConnection *connection;
-		char *buffer;
-	};
+	m_stats.messages_written++;
+
+	while (count > 0) {
+		if (m_pending.empty() || m_pending.back().size() == m_pending.back().capacity()) {
+			m_pending.push_back(AcquireWriteChunk());
+		}
+
+		auto &chunk = m_pending.back();
+		size_t copy = std::min(count, chunk.capacity() - chunk.size());
+		chunk.insert(chunk.end(), data, data + copy);
+
+		data += copy;
+		count -= copy;
+		m_pending_bytes += copy;
+	}
+
+	if (m_pending_bytes >= MaxPendingWriteBytes) {
+		Flush();
+	}
+	else {
+		QueueFlush();
+	}
+}
+
+/**
+ * Sends everything buffered since the last flush as a single uv_write
+ */
+void EQ::Net::TCPConnection::Flush()
+{
+	StopFlush();
+
+	if (!m_socket || m_pending.empty()) {
+		return;
+	}
 
-	WriteBaton *baton = new WriteBaton;
+	WriteBaton *baton = AcquireWriteBaton();
+	memset(&baton->req, 0, sizeof(uv_write_t));
+	baton->req.data = baton;
 	baton->connection = this;
-	baton->buffer = new char[count];;
+	baton->chunks.swap(m_pending);
 
-	uv_write_t *write_req = new uv_write_t;
-	memset(write_req, 0, sizeof(uv_write_t));
-	write_req->data = baton;
-	uv_buf_t send_buffers[1];
+	for (auto &chunk : baton->chunks) {
+		baton->buffers.push_back(uv_buf_init(chunk.data(), (unsigned int)chunk.size()));
+	}
 
-	memcpy(baton->buffer, data, count);
-	send_buffers[0] = uv_buf_init(baton->buffer, count);
+	m_stats.socket_writes++;
+	m_stats.bytes_written += m_pending_bytes;
+	UpdateRates(m_pending_bytes);
+	m_pending_bytes = 0;
 
-	uv_write(write_req, (uv_stream_t*)m_socket, send_buffers, 1, [](uv_write_t* req, int status) {
+	int result = uv_write(&baton->req, (uv_stream_t*)m_socket, baton->buffers.data(), (unsigned int)baton->buffers.size(), [](uv_write_t* req, int status) {
 		WriteBaton *baton = (WriteBaton*)req->data;
-		delete[] baton->buffer;
-		delete req;
+		auto connection = baton->connection;
+		ReleaseWriteBaton(baton);
 
 		if (status < 0) {
-			baton->connection->Disconnect();
+			connection->Disconnect();
 		}
+	});
 
-		delete baton;
+	if (result < 0) {
+		ReleaseWriteBaton(baton);
+		Disconnect();
+	}
+}
+
+void EQ::Net::TCPConnection::QueueFlush()
+{
+	if (m_flush_queued) {
+		return;
+	}
+
+	if (!m_flush_prepare) {
+		m_flush_prepare = new uv_prepare_t;
+		memset(m_flush_prepare, 0, sizeof(uv_prepare_t));
+		uv_prepare_init(m_socket->loop, m_flush_prepare);
+		m_flush_prepare->data = this;
+
+		m_flush_check = new uv_check_t;
+		memset(m_flush_check, 0, sizeof(uv_check_t));
+		uv_check_init(m_socket->loop, m_flush_check);
+		m_flush_check->data = this;
+	}
+
+	// prepare catches writes made outside the loop or from timers, check catches writes made from read callbacks
+	uv_prepare_start(m_flush_prepare, [](uv_prepare_t* handle) {
+		((TCPConnection*)handle->data)->Flush();
 	});
+
+	uv_check_start(m_flush_check, [](uv_check_t* handle) {
+		((TCPConnection*)handle->data)->Flush();
+	});
+
+	m_flush_queued = true;
+}
+
+void EQ::Net::TCPConnection::StopFlush()
+{
+	if (!m_flush_queued) {
+		return;
+	}
+
+	uv_prepare_stop(m_flush_prepare);
+	uv_check_stop(m_flush_check);
+	m_flush_queued = false;
+}
+
+void EQ::Net::TCPConnection::UpdateRates(size_t bytes)
+{
+	uint64_t second = uv_now(m_socket->loop) / 1000;
+	if (second != m_rate_second) {
+		bool previous = second == m_rate_second + 1;
+		m_last_bytes_per_second = previous ? m_rate_bytes : 0;
+		m_last_writes_per_second = previous ? m_rate_writes : 0;
+		m_rate_second = second;
+		m_rate_bytes = 0;
+		m_rate_writes = 0;
+	}
+
+	m_rate_bytes += bytes;
+	m_rate_writes++;
+}
+
+/**
+ * @return bytes handed to the socket during the last full second
+ */
+uint64_t EQ::Net::TCPConnection::GetBytesPerSecond() const
+{
+	if (!m_socket) {
+		return 0;
+	}
+
+	uint64_t second = uv_now(m_socket->loop) / 1000;
+	if (second == m_rate_second) {
+		return m_last_bytes_per_second;
+	}
+
+	return second == m_rate_second + 1 ? m_rate_bytes : 0;
+}
+
+/**
+ * @return uv_write calls issued during the last full second
+ */
+uint64_t EQ::Net::TCPConnection::GetSocketWritesPerSecond() const
+{
+	if (!m_socket) {
+		return 0;
+	}
+
+	uint64_t second = uv_now(m_socket->loop) / 1000;
+	if (second == m_rate_second) {
+		return m_last_writes_per_second;
+	}
+
+	return second == m_rate_second + 1 ? m_rate_writes : 0;
 }
 
 std::string EQ::Net::TCPConnection::LocalIP() const
@@ -3,12 +3,21 @@
 #include <functional>
 #include <string>
 #include <memory>
+#include <vector>
+#include <cstdint>
 #include <uv.h>
 
 namespace EQ
 {
 	namespace Net
 	{
+		struct TCPConnectionStats
+		{
+			uint64_t messages_written;
+			uint64_t bytes_written;
+			uint64_t socket_writes;
+		};
+
 		class TCPConnection
 		{
 		public:
@@ -23,6 +32,7 @@ namespace EQ
 			void Disconnect();
 			void Read(const char *data, size_t count);
 			void Write(const char *data, size_t count);
+			void Flush();
 
 			bool IsConnected() const;
 			std::string LocalIP() const;
@@ -30,10 +40,33 @@ namespace EQ
 			std::string RemoteIP() const;
 			int RemotePort() const;
 
+			const TCPConnectionStats &GetStats() const { return m_stats; }
+			uint64_t GetBytesPerSecond() const;
+			uint64_t GetSocketWritesPerSecond() const;
+
 		private:
 			TCPConnection();
 
+			void QueueFlush();
+			void StopFlush();
+			void UpdateRates(size_t bytes);
+
 			uv_tcp_t *m_socket;
+
+			// writes are buffered until the loop reaches prepare/check, then sent with one uv_write
+			uv_prepare_t *m_flush_prepare;
+			uv_check_t *m_flush_check;
+			bool m_flush_queued;
+			std::vector<std::vector<char>> m_pending;
+			size_t m_pending_bytes;
+
+			TCPConnectionStats m_stats;
+			uint64_t m_rate_second;
+			uint64_t m_rate_bytes;
+			uint64_t m_rate_writes;
+			uint64_t m_last_bytes_per_second;
+			uint64_t m_last_writes_per_second;
+
 			std::function<void(TCPConnection*, const unsigned char *, size_t)> m_on_read_cb;
 			std::function<void(TCPConnection*)> m_on_disconnect_cb;
 		};
@@ -243,6 +243,7 @@ RULE_INT (World, FVNoDropFlag, 0, "Sets the Firiona Vie settings on the client,
 RULE_BOOL (World, IPLimitDisconnectAll, false, "Disconnect all current clients by IP if they go over the IP limit.  This should allow people to quickly reconnect in the case of dead sessions waiting to timeout")
 RULE_BOOL(World, MaxClientsSimplifiedLogic, false, "New logic that only uses ExemptMaxClientsStatus and MaxClientsPerIP. Done on the loginserver. This mimics the P99-style special IP rules")
 RULE_INT (World, TellQueueSize, 20, "Maximum tell queue size")
+RULE_INT(World, WhoAllCacheMS, 1000, "How long world reuses a /who all reply for an identical query in milliseconds, 0 disables the cache")
 RULE_BOOL(World, StartZoneSameAsBindOnCreation, true, "Should the start zone always be the same location as your bind?")
 RULE_BOOL(World, EnforceCharacterLimitAtLogin, false, "Enforce the limit for characters that are online at login")
 RULE_CATEGORY_END()
@@ -296,6 +297,14 @@ RULE_BOOL(Pathing, Fear, true, "Enable pathing for fear")
 RULE_REAL(Pathing, NavmeshStepSize, 100.0f, "Step size for the movement manager")
 RULE_REAL(Pathing, ShortMovementUpdateRange, 130.0f, "Range for short movement updates")
 RULE_INT(Pathing, MaxNavmeshNodes, 4092, "Maximum navmesh nodes in a traversable path")
+RULE_INT(Pathing, PathCacheSize, 512, "Maximum number of navmesh path results kept in the path cache (0 disables the cache)")
+RULE_REAL(Pathing, PathCacheGridSize, 5.0f, "Grid size used to snap path start and end points when looking up cached paths")
+RULE_INT(Pathing, AsyncWorkerThreads, 2, "Number of worker threads used to calculate navmesh paths off the zone thread (0 calculates paths inline)")
+RULE_INT(Pathing, AsyncPathFallbackTime, 250, "Milliseconds an idle mob waits on an async path before taking a straight line step toward its destination")
+RULE_BOOL(Pathing, TieredMovementUpdates, false, "Rate limit repeated NPC movement updates per client by distance, visibility and engagement")
+RULE_INT(Pathing, TieredUpdateMediumInterval, 1000, "Milliseconds between repeated movement updates for nearby NPCs the client is not engaged with (TieredMovementUpdates)")
+RULE_INT(Pathing, TieredUpdateLowInterval, 10000, "Milliseconds between repeated movement updates for distant or unseen NPCs (TieredMovementUpdates)")
+RULE_INT(Pathing, TieredUpdateClientBudget, 100, "Maximum non-essential movement updates sent to a client per zone tick, 0 is unlimited (TieredMovementUpdates)")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(Watermap)
@@ -624,6 +633,9 @@ RULE_INT(Chat, IntervalDurationMS, 60000, "Interval length in milliseconds")
 RULE_INT(Chat, KarmaUpdateIntervalMS, 1200000, "Karma update interval in milliseconds")
 RULE_INT(Chat, KarmaGlobalChatLimit, 72, "Amount of karma you need to be able to talk in ooc/auction/chat below the level limit")
 RULE_INT(Chat, GlobalChatLevelLimit, 8, "Level limit you need to of reached to talk in ooc/auction/chat if your karma is too low")
+RULE_INT(Chat, DeliveryMessagesPerSecond, 50, "Channel messages UCS will flush to a single connection per second. 0 = unlimited")
+RULE_INT(Chat, DeliveryBurst, 150, "Channel messages UCS may flush to a single connection at once after it has been idle")
+RULE_INT(Chat, DeliveryMaxQueued, 500, "Pending channel messages held for a single connection before the oldest are dropped. 0 = unlimited")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(Merchant)
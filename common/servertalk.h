@@ -226,6 +226,8 @@
 #define ServerOP_CZSetEntityVariableByNPCTypeID		0x5018
 #define ServerOP_WWMarquee							0x5019
 #define ServerOP_QSPlayerDropItem					0x5020
+#define ServerOP_QSPlayerLogEvent					0x5021
+#define ServerOP_QSPlayerAARate						0x5022
 
 /* Query Serv Generic Packet Flag/Type Enumeration */
 enum { QSG_LFGuild = 0 }; 
@@ -1384,6 +1386,20 @@ struct QSGeneralQuery_Struct {
 	char QueryString[0];
 };
 
+struct QSPlayerLogEvent_Struct {
+	uint32 event_type;
+	uint32 char_id;
+	uint32 time;
+	uint32 event_desc_length;
+	char   event_desc[0];
+};
+
+struct QSPlayerAARate_Struct {
+	uint32 char_id;
+	int32  aa_count;
+	uint32 hour_time;
+};
+
 struct CZMessagePlayer_Struct {
 	uint32	Type;
 	char	CharName[64];
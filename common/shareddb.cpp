@@ -18,6 +18,7 @@
 
 #include <iostream>
 #include <cstring>
+#include <unordered_map>
 #include <fmt/format.h>
 
 #if defined(_MSC_VER) && _MSC_VER >= 1800
@@ -274,18 +275,15 @@ bool SharedDatabase::UpdateInventorySlot(uint32 char_id, const EQ::ItemInstance*
 		charges = 0x7FFF;
 
 	// Update/Insert item
-    std::string query = StringFormat("REPLACE INTO inventory "
-                                    "(charid, slotid, itemid, charges, instnodrop, custom_data, color, "
-                                    "augslot1, augslot2, augslot3, augslot4, augslot5, augslot6, ornamenticon, ornamentidfile, ornament_hero_model) "
-                                    "VALUES( %lu, %lu, %lu, %lu, %lu, '%s', %lu, "
-                                    "%lu, %lu, %lu, %lu, %lu, %lu, %lu, %lu, %lu)",
-                                    (unsigned long)char_id, (unsigned long)slot_id, (unsigned long)inst->GetItem()->ID,
-                                    (unsigned long)charges, (unsigned long)(inst->IsAttuned()? 1: 0),
-                                    inst->GetCustomDataString().c_str(), (unsigned long)inst->GetColor(),
-                                    (unsigned long)augslot[0], (unsigned long)augslot[1], (unsigned long)augslot[2],
-									(unsigned long)augslot[3], (unsigned long)augslot[4], (unsigned long)augslot[5], (unsigned long)inst->GetOrnamentationIcon(),
-									(unsigned long)inst->GetOrnamentationIDFile(), (unsigned long)inst->GetOrnamentHeroModel());
-	auto results = QueryDatabase(query);
+	MySQLStmtParams params;
+	params.Add(char_id).Add((uint32)slot_id).Add(inst->GetItem()->ID).Add((uint32)charges).Add((uint32)(inst->IsAttuned() ? 1 : 0))
+		.Add(inst->GetCustomDataString()).Add(inst->GetColor())
+		.Add(augslot[0]).Add(augslot[1]).Add(augslot[2]).Add(augslot[3]).Add(augslot[4]).Add(augslot[5])
+		.Add(inst->GetOrnamentationIcon()).Add(inst->GetOrnamentationIDFile()).Add(inst->GetOrnamentHeroModel());
+	auto results = ExecuteStatement("REPLACE INTO inventory "
+					"(charid, slotid, itemid, charges, instnodrop, custom_data, color, "
+					"augslot1, augslot2, augslot3, augslot4, augslot5, augslot6, ornamenticon, ornamentidfile, ornament_hero_model) "
+					"VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)", params);
 
     // Save bag contents, if slot supports bag contents
 	if (inst->IsClassBag() && EQ::InventoryProfile::SupportsContainers(slot_id))
@@ -322,16 +320,13 @@ bool SharedDatabase::UpdateSharedBankSlot(uint32 char_id, const EQ::ItemInstance
     else
         charges = 0x7FFF;
 
-    std::string query = StringFormat("REPLACE INTO sharedbank "
-                                    "(acctid, slotid, itemid, charges, custom_data, "
-                                    "augslot1, augslot2, augslot3, augslot4, augslot5, augslot6) "
-                                    "VALUES( %lu, %lu, %lu, %lu, '%s', "
-                                    "%lu, %lu, %lu, %lu, %lu, %lu)",
-                                    (unsigned long)account_id, (unsigned long)slot_id, (unsigned long)inst->GetItem()->ID,
-                                    (unsigned long)charges, inst->GetCustomDataString().c_str(), (unsigned long)augslot[0],
-									(unsigned long)augslot[1], (unsigned long)augslot[2], (unsigned long)augslot[3], (unsigned long)augslot[4],
-									(unsigned long)augslot[5]);
-    auto results = QueryDatabase(query);
+	MySQLStmtParams params;
+	params.Add(account_id).Add((uint32)slot_id).Add(inst->GetItem()->ID).Add((uint32)charges).Add(inst->GetCustomDataString())
+		.Add(augslot[0]).Add(augslot[1]).Add(augslot[2]).Add(augslot[3]).Add(augslot[4]).Add(augslot[5]);
+	auto results = ExecuteStatement("REPLACE INTO sharedbank "
+					"(acctid, slotid, itemid, charges, custom_data, "
+					"augslot1, augslot2, augslot3, augslot4, augslot5, augslot6) "
+					"VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)", params);
 
     // Save bag contents, if slot supports bag contents
 	if (inst->IsClassBag() && EQ::InventoryProfile::SupportsContainers(slot_id)) {
@@ -353,8 +348,9 @@ bool SharedDatabase::UpdateSharedBankSlot(uint32 char_id, const EQ::ItemInstance
 bool SharedDatabase::DeleteInventorySlot(uint32 char_id, int16 slot_id) {
 
 	// Delete item
-	std::string query = StringFormat("DELETE FROM inventory WHERE charid = %i AND slotid = %i", char_id, slot_id);
-    auto results = QueryDatabase(query);
+	MySQLStmtParams params;
+	params.Add(char_id).Add((int32)slot_id);
+	auto results = ExecuteStatement("DELETE FROM inventory WHERE charid = ? AND slotid = ?", params);
     if (!results.Success()) {
         return false;
     }
@@ -364,9 +360,9 @@ bool SharedDatabase::DeleteInventorySlot(uint32 char_id, int16 slot_id) {
         return true;
 
 	int16 base_slot_id = EQ::InventoryProfile::CalcSlotId(slot_id, EQ::invbag::SLOT_BEGIN);
-    query = StringFormat("DELETE FROM inventory WHERE charid = %i AND slotid >= %i AND slotid < %i",
-                        char_id, base_slot_id, (base_slot_id+10));
-    results = QueryDatabase(query);
+	MySQLStmtParams bag_params;
+	bag_params.Add(char_id).Add((int32)base_slot_id).Add((int32)(base_slot_id + 10));
+	results = ExecuteStatement("DELETE FROM inventory WHERE charid = ? AND slotid >= ? AND slotid < ?", bag_params);
     if (!results.Success()) {
         return false;
     }
@@ -468,38 +464,39 @@ bool SharedDatabase::SetStartingItems(PlayerProfile_Struct* pp, EQ::InventoryPro
 // Retrieve shared bank inventory based on either account or character
 bool SharedDatabase::GetSharedBank(uint32 id, EQ::InventoryProfile *inv, bool is_charid)
 {
-	std::string query;
+	const char *query;
 
 	if (is_charid)
-		query = StringFormat("SELECT sb.slotid, sb.itemid, sb.charges, "
-				     "sb.augslot1, sb.augslot2, sb.augslot3, "
-				     "sb.augslot4, sb.augslot5, sb.augslot6, sb.custom_data "
-				     "FROM sharedbank sb INNER JOIN character_data ch "
-				     "ON ch.account_id=sb.acctid WHERE ch.id = %i ORDER BY sb.slotid",
-				     id);
+		query = "SELECT sb.slotid, sb.itemid, sb.charges, "
+			"sb.augslot1, sb.augslot2, sb.augslot3, "
+			"sb.augslot4, sb.augslot5, sb.augslot6, sb.custom_data "
+			"FROM sharedbank sb INNER JOIN character_data ch "
+			"ON ch.account_id=sb.acctid WHERE ch.id = ? ORDER BY sb.slotid";
 	else
-		query = StringFormat("SELECT slotid, itemid, charges, "
-				     "augslot1, augslot2, augslot3, "
-				     "augslot4, augslot5, augslot6, custom_data "
-				     "FROM sharedbank WHERE acctid=%i ORDER BY slotid",
-				     id);
-	auto results = QueryDatabase(query);
+		query = "SELECT slotid, itemid, charges, "
+			"augslot1, augslot2, augslot3, "
+			"augslot4, augslot5, augslot6, custom_data "
+			"FROM sharedbank WHERE acctid = ? ORDER BY slotid";
+
+	MySQLStmtParams params;
+	params.Add(id);
+	auto results = ExecuteStatement(query, params);
 	if (!results.Success()) {
 		return false;
 	}
 
-	for (auto row = results.begin(); row != results.end(); ++row) {
-		int16 slot_id = (int16)atoi(row[0]);
-		uint32 item_id = (uint32)atoi(row[1]);
-		int8 charges = (int8)atoi(row[2]);
+	for (auto &row : results) {
+		int16 slot_id = (int16)row.GetInt32(0);
+		uint32 item_id = row.GetUInt32(1);
+		int8 charges = (int8)row.GetInt32(2);
 
 		uint32 aug[EQ::invaug::SOCKET_COUNT];
-		aug[0] = (uint32)atoi(row[3]);
-		aug[1] = (uint32)atoi(row[4]);
-		aug[2] = (uint32)atoi(row[5]);
-		aug[3] = (uint32)atoi(row[6]);
-		aug[4] = (uint32)atoi(row[7]);
-		aug[5] = (uint32)atoi(row[8]);
+		aug[0] = row.GetUInt32(3);
+		aug[1] = row.GetUInt32(4);
+		aug[2] = row.GetUInt32(5);
+		aug[3] = row.GetUInt32(6);
+		aug[4] = row.GetUInt32(7);
+		aug[5] = row.GetUInt32(8);
 
 		const EQ::ItemData *item = GetItem(item_id);
 
@@ -519,8 +516,8 @@ bool SharedDatabase::GetSharedBank(uint32 id, EQ::InventoryProfile *inv, bool is
 			}
 		}
 
-		if (inst && row[9]) {
-			std::string data_str(row[9]);
+		if (inst && !row.IsNull(9)) {
+			std::string data_str(row.GetString(9));
 			std::string idAsString;
 			std::string value;
 			bool use_id = true;
@@ -544,9 +541,8 @@ bool SharedDatabase::GetSharedBank(uint32 id, EQ::InventoryProfile *inv, bool is
 			}
 		}
 
-		// theoretically inst can be nullptr ... this would be very bad ...
-		put_slot_id = inv->PutItem(slot_id, *inst);
-		safe_delete(inst);
+		// inventory takes ownership of inst, including a nullptr or an unplaceable one
+		put_slot_id = inv->AdoptItem(slot_id, inst);
 
 		// Save ptr to item in inventory
 		if (put_slot_id != INVALID_INDEX)
@@ -569,12 +565,11 @@ bool SharedDatabase::GetInventory(uint32 char_id, EQ::InventoryProfile *inv)
 		return false;
 	
 	// Retrieve character inventory
-	std::string query =
-	    StringFormat("SELECT slotid, itemid, charges, color, augslot1, augslot2, augslot3, augslot4, augslot5, "
-			 "augslot6, instnodrop, custom_data, ornamenticon, ornamentidfile, ornament_hero_model FROM "
-			 "inventory WHERE charid = %i ORDER BY slotid",
-			 char_id);
-	auto results = QueryDatabase(query);
+	MySQLStmtParams params;
+	params.Add(char_id);
+	auto results = ExecuteStatement("SELECT slotid, itemid, charges, color, augslot1, augslot2, augslot3, augslot4, augslot5, "
+					"augslot6, instnodrop, custom_data, ornamenticon, ornamentidfile, ornament_hero_model FROM "
+					"inventory WHERE charid = ? ORDER BY slotid", params);
 	if (!results.Success()) {
 		LogError("If you got an error related to the 'instnodrop' field, run the "
 						    "following SQL Queries:\nalter table inventory add instnodrop "
@@ -588,8 +583,8 @@ bool SharedDatabase::GetInventory(uint32 char_id, EQ::InventoryProfile *inv)
 	auto pmask = inv->GetLookup()->PossessionsBitmask;
 	auto bank_size = inv->GetLookup()->InventoryTypeSize.Bank;
 
-	for (auto row = results.begin(); row != results.end(); ++row) {
-		int16 slot_id = atoi(row[0]);
+	for (auto &row : results) {
+		int16 slot_id = (int16)row.GetInt32(0);
 
 		if (slot_id <= EQ::invslot::POSSESSIONS_END && slot_id >= EQ::invslot::POSSESSIONS_BEGIN) { // Titanium thru UF check
 			if ((((uint64)1 << slot_id) & pmask) == 0) {
@@ -618,24 +613,24 @@ bool SharedDatabase::GetInventory(uint32 char_id, EQ::InventoryProfile *inv)
 			}
 		}
 
-		uint32 item_id = atoi(row[1]);
-		uint16 charges = atoi(row[2]);
-		uint32 color = atoul(row[3]);
+		uint32 item_id = row.GetUInt32(1);
+		uint16 charges = (uint16)row.GetInt32(2);
+		uint32 color = row.GetUInt32(3);
 
 		uint32 aug[EQ::invaug::SOCKET_COUNT];
 
-		aug[0] = (uint32)atoul(row[4]);
-		aug[1] = (uint32)atoul(row[5]);
-		aug[2] = (uint32)atoul(row[6]);
-		aug[3] = (uint32)atoul(row[7]);
-		aug[4] = (uint32)atoul(row[8]);
-		aug[5] = (uint32)atoul(row[9]);
+		aug[0] = row.GetUInt32(4);
+		aug[1] = row.GetUInt32(5);
+		aug[2] = row.GetUInt32(6);
+		aug[3] = row.GetUInt32(7);
+		aug[4] = row.GetUInt32(8);
+		aug[5] = row.GetUInt32(9);
 
-		bool instnodrop = (row[10] && (uint16)atoi(row[10])) ? true : false;
+		bool instnodrop = (!row.IsNull(10) && (uint16)row.GetInt32(10)) ? true : false;
 
-		uint32 ornament_icon = (uint32)atoul(row[12]);
-		uint32 ornament_idfile = (uint32)atoul(row[13]);
-		uint32 ornament_hero_model = (uint32)atoul(row[14]);
+		uint32 ornament_icon = row.GetUInt32(12);
+		uint32 ornament_idfile = row.GetUInt32(13);
+		uint32 ornament_hero_model = row.GetUInt32(14);
 
 		const EQ::ItemData *item = GetItem(item_id);
 
@@ -652,8 +647,8 @@ bool SharedDatabase::GetInventory(uint32 char_id, EQ::InventoryProfile *inv)
 		if (inst == nullptr)
 			continue;
 
-		if (row[11]) {
-			std::string data_str(row[11]);
+		if (!row.IsNull(11)) {
+			std::string data_str(row.GetString(11));
 			std::string idAsString;
 			std::string value;
 			bool use_id = true;
@@ -709,19 +704,18 @@ bool SharedDatabase::GetInventory(uint32 char_id, EQ::InventoryProfile *inv)
 			}
 		}
 
+		// inventory takes ownership of inst, no need to clone what we just built
 		if (slot_id >= 8000 && slot_id <= 8999) {
-			put_slot_id = inv->PushCursor(*inst);
+			put_slot_id = inv->AdoptCursorItem(inst);
 		} else if (slot_id >= 3111 && slot_id <= 3179) {
 			// Admins: please report any occurrences of this error
 			LogError("Warning: Defunct location for item in inventory: charid={}, item_id={}, slot_id={} .. pushing to cursor...",
 				char_id, item_id, slot_id);
-			put_slot_id = inv->PushCursor(*inst);
+			put_slot_id = inv->AdoptCursorItem(inst);
 		} else {
-			put_slot_id = inv->PutItem(slot_id, *inst);
+			put_slot_id = inv->AdoptItem(slot_id, inst);
 		}
 
-		safe_delete(inst);
-
 		// Save ptr to item in inventory
 		if (put_slot_id == INVALID_INDEX) {
 			LogError("Warning: Invalid slot_id for item in inventory: charid=[{}], item_id=[{}], slot_id=[{}]",
@@ -1352,6 +1346,437 @@ bool SharedDatabase::LoadNPCFactionLists(const std::string &prefix) {
 	return true;
 }
 
+static const std::string npc_types_columns =
+	"npc_types.id, "
+	"npc_types.name, "
+	"npc_types.level, "
+	"npc_types.race, "
+	"npc_types.class, "
+	"npc_types.hp, "
+	"npc_types.mana, "
+	"npc_types.gender, "
+	"npc_types.texture, "
+	"npc_types.helmtexture, "
+	"npc_types.herosforgemodel, "
+	"npc_types.size, "
+	"npc_types.loottable_id, "
+	"npc_types.merchant_id, "
+	"npc_types.alt_currency_id, "
+	"npc_types.adventure_template_id, "
+	"npc_types.trap_template, "
+	"npc_types.attack_speed, "
+	"npc_types.STR, "
+	"npc_types.STA, "
+	"npc_types.DEX, "
+	"npc_types.AGI, "
+	"npc_types._INT, "
+	"npc_types.WIS, "
+	"npc_types.CHA, "
+	"npc_types.MR, "
+	"npc_types.CR, "
+	"npc_types.DR, "
+	"npc_types.FR, "
+	"npc_types.PR, "
+	"npc_types.Corrup, "
+	"npc_types.PhR, "
+	"npc_types.mindmg, "
+	"npc_types.maxdmg, "
+	"npc_types.attack_count, "
+	"npc_types.special_abilities, "
+	"npc_types.npc_spells_id, "
+	"npc_types.npc_spells_effects_id, "
+	"npc_types.d_melee_texture1, "
+	"npc_types.d_melee_texture2, "
+	"npc_types.ammo_idfile, "
+	"npc_types.prim_melee_type, "
+	"npc_types.sec_melee_type, "
+	"npc_types.ranged_type, "
+	"npc_types.runspeed, "
+	"npc_types.findable, "
+	"npc_types.trackable, "
+	"npc_types.hp_regen_rate, "
+	"npc_types.mana_regen_rate, "
+	"npc_types.aggroradius, "
+	"npc_types.assistradius, "
+	"npc_types.bodytype, "
+	"npc_types.npc_faction_id, "
+	"npc_types.face, "
+	"npc_types.luclin_hairstyle, "
+	"npc_types.luclin_haircolor, "
+	"npc_types.luclin_eyecolor, "
+	"npc_types.luclin_eyecolor2, "
+	"npc_types.luclin_beardcolor, "
+	"npc_types.luclin_beard, "
+	"npc_types.drakkin_heritage, "
+	"npc_types.drakkin_tattoo, "
+	"npc_types.drakkin_details, "
+	"npc_types.armortint_id, "
+	"npc_types.armortint_red, "
+	"npc_types.armortint_green, "
+	"npc_types.armortint_blue, "
+	"npc_types.see_invis, "
+	"npc_types.see_invis_undead, "
+	"npc_types.lastname, "
+	"npc_types.qglobal, "
+	"npc_types.AC, "
+	"npc_types.npc_aggro, "
+	"npc_types.spawn_limit, "
+	"npc_types.see_hide, "
+	"npc_types.see_improved_hide, "
+	"npc_types.ATK, "
+	"npc_types.Accuracy, "
+	"npc_types.Avoidance, "
+	"npc_types.slow_mitigation, "
+	"npc_types.maxlevel, "
+	"npc_types.scalerate, "
+	"npc_types.private_corpse, "
+	"npc_types.unique_spawn_by_name, "
+	"npc_types.underwater, "
+	"npc_types.emoteid, "
+	"npc_types.spellscale, "
+	"npc_types.healscale, "
+	"npc_types.no_target_hotkey, "
+	"npc_types.raid_target, "
+	"npc_types.attack_delay, "
+	"npc_types.light, "
+	"npc_types.armtexture, "
+	"npc_types.bracertexture, "
+	"npc_types.handtexture, "
+	"npc_types.legtexture, "
+	"npc_types.feettexture, "
+	"npc_types.ignore_despawn, "
+	"npc_types.show_name, "
+	"npc_types.untargetable, "
+	"npc_types.charm_ac, "
+	"npc_types.charm_min_dmg, "
+	"npc_types.charm_max_dmg, "
+	"npc_types.charm_attack_delay, "
+	"npc_types.charm_accuracy_rating, "
+	"npc_types.charm_avoidance_rating, "
+	"npc_types.charm_atk, "
+	"npc_types.skip_global_loot, "
+	"npc_types.rare_spawn, "
+	"npc_types.stuck_behavior, "
+	"npc_types.model, "
+	"npc_types.flymode, "
+	"npc_types.always_aggro ";
+
+static const std::string npc_types_tint_columns =
+	"red1h, grn1h, blu1h, "
+	"red2c, grn2c, blu2c, "
+	"red3a, grn3a, blu3a, "
+	"red4b, grn4b, blu4b, "
+	"red5g, grn5g, blu5g, "
+	"red6l, grn6l, blu6l, "
+	"red7f, grn7f, blu7f, "
+	"red8x, grn8x, blu8x, "
+	"red9x, grn9x, blu9x ";
+
+static void ReadNPCTypeTint(MySQLRequestRow &row, int first_column, EQ::TintProfile &tint)
+{
+	for (int index = EQ::textures::textureBegin; index <= EQ::textures::LastTexture; index++) {
+		tint.Slot[index].Color = atoi(row[first_column + index * 3]) << 16;
+		tint.Slot[index].Color |= atoi(row[first_column + index * 3 + 1]) << 8;
+		tint.Slot[index].Color |= atoi(row[first_column + index * 3 + 2]);
+		tint.Slot[index].Color |= (tint.Slot[index].Color) ? (0xFF << 24) : 0;
+	}
+}
+
+bool SharedDatabase::LoadNPCTypeTint(uint32 armor_tint_id, EQ::TintProfile &tint)
+{
+	std::string query = StringFormat("SELECT %s FROM npc_types_tint WHERE id = %u", npc_types_tint_columns.c_str(), armor_tint_id);
+	auto results = QueryDatabase(query);
+	if (!results.Success() || results.RowCount() == 0) {
+		return false;
+	}
+
+	auto row = results.begin();
+	ReadNPCTypeTint(row, 0, tint);
+
+	return true;
+}
+
+bool SharedDatabase::QueryNPCTypes(const std::string &where_condition, std::vector<NPCType> &npc_types, bool preload_tints)
+{
+	// a full table load looks every tint up, grab them in one query instead of one per npc
+	std::unordered_map<uint32, EQ::TintProfile> tint_cache;
+	std::unordered_map<uint32, EQ::TintProfile> *tints = nullptr;
+	if (preload_tints) {
+		auto results = QueryDatabase(StringFormat("SELECT id, %s FROM npc_types_tint", npc_types_tint_columns.c_str()));
+		if (results.Success()) {
+			for (auto row = results.begin(); row != results.end(); ++row) {
+				ReadNPCTypeTint(row, 1, tint_cache[atoul(row[0])]);
+			}
+			tints = &tint_cache;
+		}
+	}
+
+	std::string query = StringFormat("SELECT %s FROM npc_types %s", npc_types_columns.c_str(), where_condition.c_str());
+	auto results = QueryDatabase(query);
+	if (!results.Success()) {
+		return false;
+	}
+
+	npc_types.reserve(npc_types.size() + results.RowCount());
+
+	for (auto row = results.begin(); row != results.end(); ++row) {
+		npc_types.emplace_back();
+		NPCType &npc = npc_types.back();
+		memset(&npc, 0, sizeof(npc));
+
+		npc.npc_id = atoi(row[0]);
+
+		strn0cpy(npc.name, row[1], 50);
+
+		npc.level              = atoi(row[2]);
+		npc.race               = atoi(row[3]);
+		npc.class_             = atoi(row[4]);
+		npc.max_hp             = atoi(row[5]);
+		npc.current_hp         = npc.max_hp;
+		npc.Mana               = atoi(row[6]);
+		npc.gender             = atoi(row[7]);
+		npc.texture            = atoi(row[8]);
+		npc.helmtexture        = atoi(row[9]);
+		npc.herosforgemodel    = atoul(row[10]);
+		npc.size               = atof(row[11]);
+		npc.loottable_id       = atoi(row[12]);
+		npc.merchanttype       = atoi(row[13]);
+		npc.alt_currency_type  = atoi(row[14]);
+		npc.adventure_template = atoi(row[15]);
+		npc.trap_template      = atoi(row[16]);
+		npc.attack_speed       = atof(row[17]);
+		npc.STR                = atoi(row[18]);
+		npc.STA                = atoi(row[19]);
+		npc.DEX                = atoi(row[20]);
+		npc.AGI                = atoi(row[21]);
+		npc.INT                = atoi(row[22]);
+		npc.WIS                = atoi(row[23]);
+		npc.CHA                = atoi(row[24]);
+		npc.MR                 = atoi(row[25]);
+		npc.CR                 = atoi(row[26]);
+		npc.DR                 = atoi(row[27]);
+		npc.FR                 = atoi(row[28]);
+		npc.PR                 = atoi(row[29]);
+		npc.Corrup             = atoi(row[30]);
+		npc.PhR                = atoi(row[31]);
+		npc.min_dmg            = atoi(row[32]);
+		npc.max_dmg            = atoi(row[33]);
+		npc.attack_count       = atoi(row[34]);
+
+		if (row[35] != nullptr) {
+			strn0cpy(npc.special_abilities, row[35], 512);
+		}
+		else {
+			npc.special_abilities[0] = '\0';
+		}
+
+		npc.npc_spells_id         = atoi(row[36]);
+		npc.npc_spells_effects_id = atoi(row[37]);
+		npc.d_melee_texture1      = atoi(row[38]);
+		npc.d_melee_texture2      = atoi(row[39]);
+		strn0cpy(npc.ammo_idfile, row[40], 30);
+		npc.prim_melee_type = atoi(row[41]);
+		npc.sec_melee_type  = atoi(row[42]);
+		npc.ranged_type     = atoi(row[43]);
+		npc.runspeed        = atof(row[44]);
+		npc.findable        = atoi(row[45]) == 0 ? false : true;
+		npc.trackable       = atoi(row[46]) == 0 ? false : true;
+		npc.hp_regen        = atoi(row[47]);
+		npc.mana_regen      = atoi(row[48]);
+
+		// set default value for aggroradius
+		npc.aggroradius = (int32) atoi(row[49]);
+		if (npc.aggroradius <= 0) {
+			npc.aggroradius = 70;
+		}
+
+		npc.assistradius = (int32) atoi(row[50]);
+		if (npc.assistradius <= 0) {
+			npc.assistradius = npc.aggroradius;
+		}
+
+		if (row[51] && strlen(row[51])) {
+			npc.bodytype = (uint8) atoi(row[51]);
+		}
+		else {
+			npc.bodytype = 0;
+		}
+
+		npc.npc_faction_id = atoi(row[52]);
+
+		npc.luclinface       = atoi(row[53]);
+		npc.hairstyle        = atoi(row[54]);
+		npc.haircolor        = atoi(row[55]);
+		npc.eyecolor1        = atoi(row[56]);
+		npc.eyecolor2        = atoi(row[57]);
+		npc.beardcolor       = atoi(row[58]);
+		npc.beard            = atoi(row[59]);
+		npc.drakkin_heritage = atoi(row[60]);
+		npc.drakkin_tattoo   = atoi(row[61]);
+		npc.drakkin_details  = atoi(row[62]);
+
+		uint32 armor_tint_id = atoi(row[63]);
+
+		npc.armor_tint.Head.Color = (atoi(row[64]) & 0xFF) << 16;
+		npc.armor_tint.Head.Color |= (atoi(row[65]) & 0xFF) << 8;
+		npc.armor_tint.Head.Color |= (atoi(row[66]) & 0xFF);
+		npc.armor_tint.Head.Color |= (npc.armor_tint.Head.Color) ? (0xFF << 24) : 0;
+
+		if (armor_tint_id != 0) {
+			if (tints) {
+				auto tint = tints->find(armor_tint_id);
+				if (tint == tints->end()) {
+					armor_tint_id = 0;
+				}
+				else {
+					npc.armor_tint = tint->second;
+				}
+			}
+			else if (!LoadNPCTypeTint(armor_tint_id, npc.armor_tint)) {
+				armor_tint_id = 0;
+			}
+		}
+		// Try loading npc_types tint fields if armor tint is 0 or query failed to get results
+		if (armor_tint_id == 0) {
+			for (int index = EQ::textures::armorChest; index < EQ::textures::materialCount; index++) {
+				npc.armor_tint.Slot[index].Color = npc.armor_tint.Slot[0].Color; // odd way to 'zero-out' the array...
+			}
+		}
+
+		npc.see_invis        = atoi(row[67]);
+		npc.see_invis_undead = atoi(row[68]) == 0 ? false : true;    // Set see_invis_undead flag
+
+		if (row[69] != nullptr) {
+			strn0cpy(npc.lastname, row[69], 32);
+		}
+
+		npc.qglobal              = atoi(row[70]) == 0 ? false : true;    // qglobal
+		npc.AC                   = atoi(row[71]);
+		npc.npc_aggro            = atoi(row[72]) == 0 ? false : true;
+		npc.spawn_limit          = atoi(row[73]);
+		npc.see_hide             = atoi(row[74]) == 0 ? false : true;
+		npc.see_improved_hide    = atoi(row[75]) == 0 ? false : true;
+		npc.ATK                  = atoi(row[76]);
+		npc.accuracy_rating      = atoi(row[77]);
+		npc.avoidance_rating     = atoi(row[78]);
+		npc.slow_mitigation      = atoi(row[79]);
+		npc.maxlevel             = atoi(row[80]);
+		npc.scalerate            = atoi(row[81]);
+		npc.private_corpse       = atoi(row[82]) == 1 ? true : false;
+		npc.unique_spawn_by_name = atoi(row[83]) == 1 ? true : false;
+		npc.underwater           = atoi(row[84]) == 1 ? true : false;
+		npc.emoteid              = atoi(row[85]);
+		npc.spellscale           = atoi(row[86]);
+		npc.healscale            = atoi(row[87]);
+		npc.no_target_hotkey     = atoi(row[88]) == 1 ? true : false;
+		npc.raid_target          = atoi(row[89]) == 0 ? false : true;
+		npc.attack_delay         = atoi(row[90]) * 100; // TODO: fix DB
+		npc.light                = (atoi(row[91]) & 0x0F);
+
+		npc.armtexture     = atoi(row[92]);
+		npc.bracertexture  = atoi(row[93]);
+		npc.handtexture    = atoi(row[94]);
+		npc.legtexture     = atoi(row[95]);
+		npc.feettexture    = atoi(row[96]);
+		npc.ignore_despawn = atoi(row[97]) == 1 ? true : false;
+		npc.show_name      = atoi(row[98]) != 0 ? true : false;
+		npc.untargetable   = atoi(row[99]) != 0 ? true : false;
+
+		npc.charm_ac               = atoi(row[100]);
+		npc.charm_min_dmg          = atoi(row[101]);
+		npc.charm_max_dmg          = atoi(row[102]);
+		npc.charm_attack_delay     = atoi(row[103]) * 100; // TODO: fix DB
+		npc.charm_accuracy_rating  = atoi(row[104]);
+		npc.charm_avoidance_rating = atoi(row[105]);
+		npc.charm_atk              = atoi(row[106]);
+
+		npc.skip_global_loot 	= atoi(row[107]) != 0;
+		npc.rare_spawn       	= atoi(row[108]) != 0;
+		npc.stuck_behavior   	= atoi(row[109]);
+		npc.use_model        	= atoi(row[110]);
+		npc.flymode          	= atoi(row[111]);
+		npc.always_aggro	        = atoi(row[112]);
+
+		npc.skip_auto_scale = false; // hardcoded here for now
+	}
+
+	return true;
+}
+
+void SharedDatabase::GetNPCTypesCount(uint32 &npc_type_count, uint32 &max_npc_type_id)
+{
+	npc_type_count = 0;
+	max_npc_type_id = 0;
+
+	const std::string query = "SELECT COUNT(*), MAX(id) FROM npc_types";
+	auto results = QueryDatabase(query);
+	if (!results.Success() || results.RowCount() == 0) {
+		return;
+	}
+
+	auto row = results.begin();
+
+	npc_type_count = static_cast<uint32>(atoul(row[0]));
+	max_npc_type_id = static_cast<uint32>(atoul(row[1] ? row[1] : "0"));
+}
+
+void SharedDatabase::LoadNPCTypes(void *data, uint32 size, uint32 npc_type_count, uint32 max_npc_type_id)
+{
+	EQ::FixedMemoryHashSet<NPCType> hash(reinterpret_cast<uint8 *>(data), size, npc_type_count, max_npc_type_id);
+
+	std::vector<NPCType> npc_types;
+	if (!QueryNPCTypes("ORDER BY id", npc_types, true)) {
+		return;
+	}
+
+	for (auto &npc : npc_types) {
+		if (npc.npc_id > max_npc_type_id) {
+			continue;
+		}
+
+		try {
+			hash.insert(npc.npc_id, npc);
+		} catch (std::exception &ex) {
+			LogError("Database::LoadNPCTypes: {}", ex.what());
+			break;
+		}
+	}
+}
+
+bool SharedDatabase::LoadNPCTypes(const std::string &prefix)
+{
+	npc_types_mmf.reset(nullptr);
+	npc_types_hash.reset(nullptr);
+
+	try {
+		auto Config = EQEmuConfig::get();
+		EQ::IPCMutex mutex("npc_types");
+		mutex.Lock();
+		std::string file_name = Config->SharedMemDir + prefix + std::string("npc_types");
+		npc_types_mmf = std::unique_ptr<EQ::MemoryMappedFile>(new EQ::MemoryMappedFile(file_name));
+		npc_types_hash = std::unique_ptr<EQ::FixedMemoryHashSet<NPCType>>(new EQ::FixedMemoryHashSet<NPCType>(reinterpret_cast<uint8 *>(npc_types_mmf->Get()), npc_types_mmf->Size()));
+		mutex.Unlock();
+	} catch (std::exception &ex) {
+		LogError("Error Loading npc types: {}", ex.what());
+		return false;
+	}
+
+	return true;
+}
+
+const NPCType *SharedDatabase::GetNPCType(uint32 id)
+{
+	if (!npc_types_hash || id > npc_types_hash->max_key()) {
+		return nullptr;
+	}
+
+	if (npc_types_hash->exists(id)) {
+		return &(npc_types_hash->at(id));
+	}
+
+	return nullptr;
+}
+
 // Create appropriate EQ::ItemInstance class
 EQ::ItemInstance* SharedDatabase::CreateItem(uint32 item_id, int16 charges, uint32 aug1, uint32 aug2, uint32 aug3, uint32 aug4, uint32 aug5, uint32 aug6, uint8 attuned)
 {
@@ -1690,7 +2115,7 @@ int SharedDatabase::GetMaxSpellID() {
 	return atoi(row[0]);
 }
 
-bool SharedDatabase::LoadSpells(const std::string &prefix, int32 *records, const SPDat_Spell_Struct **sp) {
+bool SharedDatabase::LoadSpells(const std::string &prefix, int32 *records, const SPDat_Spell_Struct **sp, SPDat_Spell_Hot *hot) {
 	spells_mmf.reset(nullptr);
 
 	try {
@@ -1700,8 +2125,16 @@ bool SharedDatabase::LoadSpells(const std::string &prefix, int32 *records, const
 	
 		std::string file_name = Config->SharedMemDir + prefix + std::string("spells");
 		spells_mmf = std::unique_ptr<EQ::MemoryMappedFile>(new EQ::MemoryMappedFile(file_name));
-		*records = *reinterpret_cast<uint32*>(spells_mmf->Get());
+		int32 count = *reinterpret_cast<uint32*>(spells_mmf->Get());
+		uint32 expected = sizeof(uint32) + count * sizeof(SPDat_Spell_Struct) + GetSpellHotViewSize(count);
+		if (spells_mmf->Size() < expected) {
+			EQ_EXCEPT("SharedDatabase", "Spells segment is missing the hot view, rerun shared_memory");
+		}
+
+		*records = count;
 		*sp = reinterpret_cast<const SPDat_Spell_Struct*>((char*)spells_mmf->Get() + 4);
+		if (hot)
+			MapSpellHotView(*sp + count, count, hot);
 		mutex.Unlock();
 	}
 	catch(std::exception& ex) {
@@ -1877,9 +2310,11 @@ void SharedDatabase::LoadSpells(void *data, int max_spells) {
 		sp[tempid].min_range = static_cast<float>(atoi(row[231]));
 		sp[tempid].no_remove = atoi(row[232]) != 0;
 		sp[tempid].DamageShieldType = 0;
+		BuildSpellEffectMask(sp[tempid]);
     }
 
     LoadDamageShieldTypes(sp, max_spells);
+	BuildSpellHotView(sp, max_spells, sp + max_spells);
 }
 
 int SharedDatabase::GetMaxBaseDataLevel() {
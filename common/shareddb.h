@@ -25,12 +25,14 @@
 #include "skills.h"
 #include "spdat.h"
 #include "base_data.h"
+#include "npc_type.h"
 #include "fixed_memory_hash_set.h"
 #include "fixed_memory_variable_hash_set.h"
 
 #include <list>
 #include <map>
 #include <memory>
+#include <vector>
 
 class EvolveInfo;
 struct BaseDataStruct;
@@ -134,13 +136,22 @@ class SharedDatabase : public Database
 		const LootTable_Struct* GetLootTable(uint32 loottable_id);
 		const LootDrop_Struct* GetLootDrop(uint32 lootdrop_id);
 
+		//npc types
+		void GetNPCTypesCount(uint32 &npc_type_count, uint32 &max_npc_type_id);
+		void LoadNPCTypes(void *data, uint32 size, uint32 npc_type_count, uint32 max_npc_type_id);
+		bool LoadNPCTypes(const std::string &prefix);
+		const NPCType* GetNPCType(uint32 id);
+		bool HasSharedNPCTypes() const { return npc_types_hash != nullptr; }
+		bool QueryNPCTypes(const std::string &where_condition, std::vector<NPCType> &npc_types, bool preload_tints = false);
+		bool LoadNPCTypeTint(uint32 armor_tint_id, EQ::TintProfile &tint);
+
 		void LoadSkillCaps(void *data);
 		bool LoadSkillCaps(const std::string &prefix);
 		uint16 GetSkillCap(uint8 Class_, EQ::skills::SkillType Skill, uint8 Level);
 		uint8 GetTrainLevel(uint8 Class_, EQ::skills::SkillType Skill, uint8 Level);
 
 		int GetMaxSpellID();
-		bool LoadSpells(const std::string &prefix, int32 *records, const SPDat_Spell_Struct **sp);
+		bool LoadSpells(const std::string &prefix, int32 *records, const SPDat_Spell_Struct **sp, SPDat_Spell_Hot *hot = nullptr);
 		void LoadSpells(void *data, int max_spells);
 		void LoadDamageShieldTypes(SPDat_Spell_Struct* sp, int32 iMaxSpellID);
 
@@ -160,6 +171,8 @@ class SharedDatabase : public Database
 		std::unique_ptr<EQ::FixedMemoryVariableHashSet<LootTable_Struct>> loot_table_hash;
 		std::unique_ptr<EQ::MemoryMappedFile> loot_drop_mmf;
 		std::unique_ptr<EQ::FixedMemoryVariableHashSet<LootDrop_Struct>> loot_drop_hash;
+		std::unique_ptr<EQ::MemoryMappedFile> npc_types_mmf;
+		std::unique_ptr<EQ::FixedMemoryHashSet<NPCType>> npc_types_hash;
 		std::unique_ptr<EQ::MemoryMappedFile> base_data_mmf;
 		std::unique_ptr<EQ::MemoryMappedFile> spells_mmf;
 };
@@ -215,44 +215,8 @@ bool IsGroupOnlySpell(uint16 spell_id)
 
 bool IsBeneficialSpell(uint16 spell_id)
 {
-	if (!IsValidSpell(spell_id))
-		return false;
-
-	// You'd think just checking goodEffect flag would be enough?
-	if (spells[spell_id].goodEffect == 1) {
-		// If the target type is ST_Self or ST_Pet and is a SE_CancleMagic spell
-		// it is not Beneficial
-		SpellTargetType tt = spells[spell_id].targettype;
-		if (tt != ST_Self && tt != ST_Pet &&
-				IsEffectInSpell(spell_id, SE_CancelMagic))
-			return false;
-
-		// When our targettype is ST_Target, ST_AETarget, ST_Aniaml, ST_Undead, or ST_Pet
-		// We need to check more things!
-		if (tt == ST_Target || tt == ST_AETarget || tt == ST_Animal ||
-				tt == ST_Undead || tt == ST_Pet) {
-			uint16 sai = spells[spell_id].SpellAffectIndex;
-
-			// If the resisttype is magic and SpellAffectIndex is Calm/memblur/dispell sight
-			// it's not beneficial
-			if (spells[spell_id].resisttype == RESIST_MAGIC) {
-				// checking these SAI cause issues with the rng defensive proc line
-				// So I guess instead of fixing it for real, just a quick hack :P
-				if (spells[spell_id].effectid[0] != SE_DefensiveProc &&
-				    (sai == SAI_Calm || sai == SAI_Dispell_Sight || sai == SAI_Memory_Blur ||
-				     sai == SAI_Calm_Song))
-					return false;
-			} else {
-				// If the resisttype is not magic and spell is Bind Sight or Cast Sight
-				// It's not beneficial
-				if ((sai == SAI_Calm && IsEffectInSpell(spell_id, SE_Harmony)) || (sai == SAI_Calm_Song && IsEffectInSpell(spell_id, SE_BindSight)) || (sai == SAI_Dispell_Sight && spells[spell_id].skill == 18 && !IsEffectInSpell(spell_id, SE_VoiceGraft)))
-					return false;
-			}
-		}
-	}
-
-	// And finally, if goodEffect is not 0 or if it's a group spell it's beneficial
-	return spells[spell_id].goodEffect != 0 || IsGroupSpell(spell_id);
+	// precomputed by IsBeneficialSpellRecord when the spells segment is built
+	return SpellHotHasFlag(spell_id, SPELL_HOT_BENEFICIAL);
 }
 
 bool IsDetrimentalSpell(uint16 spell_id)
@@ -461,10 +425,7 @@ bool IsTGBCompatibleSpell(uint16 spell_id)
 
 bool IsBardSong(uint16 spell_id)
 {
-	if (IsValidSpell(spell_id) && spells[spell_id].classes[BARD - 1] < 255 && !spells[spell_id].IsDisciplineBuff)
-		return true;
-
-	return false;
+	return SpellHotHasFlag(spell_id, SPELL_HOT_BARD_SONG);
 }
 
 bool IsEffectInSpell(uint16 spellid, int effect)
@@ -474,8 +435,11 @@ bool IsEffectInSpell(uint16 spellid, int effect)
 	if (!IsValidSpell(spellid))
 		return false;
 
+	if (IsEffectMaskable(effect))
+		return (spells_hot.effect_mask[spellid][effect >> 5] & (1u << (effect & 31))) != 0;
+
 	for (j = 0; j < EFFECT_COUNT; j++)
-		if (spells[spellid].effectid[j] == effect)
+		if (spells_hot.effectid[spellid][j] == effect)
 			return true;
 
 	return false;
@@ -504,11 +468,8 @@ bool IsBlankSpellEffect(uint16 spellid, int effect_index)
 // checks some things about a spell id, to see if we can proceed
 bool IsValidSpell(uint32 spellid)
 {
-	if (SPDAT_RECORDS > 0 && spellid != 0 && spellid != 1 &&
-			spellid != 0xFFFFFFFF && spellid < SPDAT_RECORDS && spells[spellid].player_1[0])
-		return true;
-
-	return false;
+	// id 0/1 and records without a player_1 tag are left out when the flag is built
+	return spellid < static_cast<uint32>(spells_hot.records) && (spells_hot.flags[spellid] & SPELL_HOT_VALID);
 }
 
 // returns the lowest level of any caster which can use the spell
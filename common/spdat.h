@@ -35,6 +35,8 @@
 
 
 #define EFFECT_COUNT 12
+#define SPELL_EFFECT_MASK_BITS 512	// effect ids below this are tracked in SPDat_Spell_Struct::effect_mask
+#define SPELL_EFFECT_MASK_WORDS (SPELL_EFFECT_MASK_BITS / 32)
 #define MAX_SPELL_TRIGGER 12	// One for each slot(only 6 for AA since AA use 2)
 #define MAX_RESISTABLE_EFFECTS 12	// Number of effects that are typcially checked agianst resists.
 #define MaxLimitInclude 16 //Number(x 0.5) of focus Limiters that have inclusive checks used when calcing focus effects
@@ -863,10 +865,44 @@ struct SPDat_Spell_Struct
 /* 235 */	//bool is_beta_only; // -- IS_BETA_ONLY
 /* 236 */	//int spell_subgroup; // -- SPELL_SUBGROUP
 			uint8 DamageShieldType; // This field does not exist in spells_us.txt
+			uint32 effect_mask[SPELL_EFFECT_MASK_WORDS]; // bit per effect id in effectid[], built at load
 };
 
+#define SPELL_HOT_VALID			0x01	// passes IsValidSpell
+#define SPELL_HOT_BENEFICIAL	0x02	// passes IsBeneficialSpell
+#define SPELL_HOT_BARD_SONG		0x04	// passes IsBardSong
+
+// Compact copy of the fields hot paths read (effect slots, target/resist type,
+// precomputed flags), one array per field. shared_memory writes it into the
+// spells segment right after the full records; the pointers are set when the
+// segment is mapped.
+struct SPDat_Spell_Hot
+{
+	int32 records;
+	const int32 (*effectid)[EFFECT_COUNT];
+	const int32 (*base)[EFFECT_COUNT];
+	const int32 (*base2)[EFFECT_COUNT];
+	const int32 (*max)[EFFECT_COUNT];
+	const uint32 (*effect_mask)[SPELL_EFFECT_MASK_WORDS];
+	const uint8 *targettype;
+	const int16 *resisttype;
+	const uint8 *flags;
+};
+
+// spdat_hot.cpp, these don't touch the spells[] global so the shared memory loader can use them
+uint32 GetSpellHotViewSize(int records);
+void BuildSpellHotView(const SPDat_Spell_Struct *sp, int records, void *dest);
+void MapSpellHotView(const void *data, int records, SPDat_Spell_Hot *view);
+bool IsBeneficialSpellRecord(const SPDat_Spell_Struct &spell);
+
 extern const SPDat_Spell_Struct* spells;
 extern int32 SPDAT_RECORDS;
+extern SPDat_Spell_Hot spells_hot;
+
+inline bool SpellHotHasFlag(uint16 spell_id, uint8 flag)
+{
+	return spell_id < spells_hot.records && (spells_hot.flags[spell_id] & flag) != 0;
+}
 
 bool IsTargetableAESpell(uint16 spell_id);
 bool IsSacrificeSpell(uint16 spell_id);
@@ -908,6 +944,27 @@ bool IsGroupSpell(uint16 spell_id);
 bool IsTGBCompatibleSpell(uint16 spell_id);
 bool IsBardSong(uint16 spell_id);
 bool IsEffectInSpell(uint16 spellid, int effect);
+
+// false for effect ids outside the mask, callers have to scan effectid[] for those
+inline bool IsEffectMaskable(int effect) { return effect >= 0 && effect < SPELL_EFFECT_MASK_BITS; }
+inline bool SpellEffectMaskHas(const SPDat_Spell_Struct &spell, int effect)
+{
+	return (spell.effect_mask[effect >> 5] & (1u << (effect & 31))) != 0;
+}
+
+// inline so the shared memory loader doesn't drag in spdat.cpp and its spells[] global
+inline void BuildSpellEffectMask(SPDat_Spell_Struct &spell)
+{
+	for (int j = 0; j < SPELL_EFFECT_MASK_WORDS; j++)
+		spell.effect_mask[j] = 0;
+
+	for (int j = 0; j < EFFECT_COUNT; j++) {
+		int effect = spell.effectid[j];
+		if (IsEffectMaskable(effect))
+			spell.effect_mask[effect >> 5] |= 1u << (effect & 31);
+	}
+}
+
 bool IsBlankSpellEffect(uint16 spellid, int effect_index);
 bool IsValidSpell(uint32 spellid);
 bool IsSummonSpell(uint16 spellid);
@@ -0,0 +1,165 @@
+/*	EQEMu: Everquest Server Emulator
+	Copyright (C) 2001-2020 EQEMu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+#include "classes.h"
+#include "spdat.h"
+
+#include <string.h>
+
+/*
+	Hot view layout, one array per field, each `records` long:
+
+		int32 effectid[EFFECT_COUNT], base[EFFECT_COUNT], base2[EFFECT_COUNT], max[EFFECT_COUNT]
+		uint32 effect_mask[SPELL_EFFECT_MASK_WORDS]
+		int16 resisttype
+		uint8 targettype
+		uint8 flags
+
+	Widest types first so every array stays aligned as long as the view starts
+	on a 4 byte boundary, which it does right after the full records.
+*/
+struct SpellHotOffsets
+{
+	uint32 effectid;
+	uint32 base;
+	uint32 base2;
+	uint32 max;
+	uint32 effect_mask;
+	uint32 resisttype;
+	uint32 targettype;
+	uint32 flags;
+	uint32 size;
+};
+
+static SpellHotOffsets GetSpellHotOffsets(int records)
+{
+	SpellHotOffsets o;
+	uint32 n = records > 0 ? static_cast<uint32>(records) : 0;
+	uint32 slots = n * EFFECT_COUNT * sizeof(int32);
+
+	o.effectid = 0;
+	o.base = o.effectid + slots;
+	o.base2 = o.base + slots;
+	o.max = o.base2 + slots;
+	o.effect_mask = o.max + slots;
+	o.resisttype = o.effect_mask + n * SPELL_EFFECT_MASK_WORDS * sizeof(uint32);
+	o.targettype = o.resisttype + n * sizeof(int16);
+	o.flags = o.targettype + n * sizeof(uint8);
+	o.size = o.flags + n * sizeof(uint8);
+	return o;
+}
+
+uint32 GetSpellHotViewSize(int records)
+{
+	return GetSpellHotOffsets(records).size;
+}
+
+// IsBeneficialSpell against a record rather than spells[], the spell is already known valid
+bool IsBeneficialSpellRecord(const SPDat_Spell_Struct &spell)
+{
+	// You'd think just checking goodEffect flag would be enough?
+	if (spell.goodEffect == 1) {
+		// If the target type is ST_Self or ST_Pet and is a SE_CancleMagic spell
+		// it is not Beneficial
+		SpellTargetType tt = spell.targettype;
+		if (tt != ST_Self && tt != ST_Pet &&
+				SpellEffectMaskHas(spell, SE_CancelMagic))
+			return false;
+
+		// When our targettype is ST_Target, ST_AETarget, ST_Aniaml, ST_Undead, or ST_Pet
+		// We need to check more things!
+		if (tt == ST_Target || tt == ST_AETarget || tt == ST_Animal ||
+				tt == ST_Undead || tt == ST_Pet) {
+			uint16 sai = spell.SpellAffectIndex;
+
+			// If the resisttype is magic and SpellAffectIndex is Calm/memblur/dispell sight
+			// it's not beneficial
+			if (spell.resisttype == RESIST_MAGIC) {
+				// checking these SAI cause issues with the rng defensive proc line
+				// So I guess instead of fixing it for real, just a quick hack :P
+				if (spell.effectid[0] != SE_DefensiveProc &&
+				    (sai == SAI_Calm || sai == SAI_Dispell_Sight || sai == SAI_Memory_Blur ||
+				     sai == SAI_Calm_Song))
+					return false;
+			} else {
+				// If the resisttype is not magic and spell is Bind Sight or Cast Sight
+				// It's not beneficial
+				if ((sai == SAI_Calm && SpellEffectMaskHas(spell, SE_Harmony)) || (sai == SAI_Calm_Song && SpellEffectMaskHas(spell, SE_BindSight)) || (sai == SAI_Dispell_Sight && spell.skill == 18 && !SpellEffectMaskHas(spell, SE_VoiceGraft)))
+					return false;
+			}
+		}
+	}
+
+	// And finally, if goodEffect is not 0 or if it's a group spell it's beneficial
+	return spell.goodEffect != 0 || spell.targettype == ST_AEBard || spell.targettype == ST_Group ||
+		spell.targettype == ST_GroupTeleport;
+}
+
+void BuildSpellHotView(const SPDat_Spell_Struct *sp, int records, void *dest)
+{
+	SpellHotOffsets o = GetSpellHotOffsets(records);
+	char *base = reinterpret_cast<char*>(dest);
+
+	int32 (*effectid)[EFFECT_COUNT] = reinterpret_cast<int32(*)[EFFECT_COUNT]>(base + o.effectid);
+	int32 (*base1)[EFFECT_COUNT] = reinterpret_cast<int32(*)[EFFECT_COUNT]>(base + o.base);
+	int32 (*base2)[EFFECT_COUNT] = reinterpret_cast<int32(*)[EFFECT_COUNT]>(base + o.base2);
+	int32 (*max)[EFFECT_COUNT] = reinterpret_cast<int32(*)[EFFECT_COUNT]>(base + o.max);
+	uint32 (*effect_mask)[SPELL_EFFECT_MASK_WORDS] = reinterpret_cast<uint32(*)[SPELL_EFFECT_MASK_WORDS]>(base + o.effect_mask);
+	int16 *resisttype = reinterpret_cast<int16*>(base + o.resisttype);
+	uint8 *targettype = reinterpret_cast<uint8*>(base + o.targettype);
+	uint8 *flags = reinterpret_cast<uint8*>(base + o.flags);
+
+	for (int i = 0; i < records; ++i) {
+		const SPDat_Spell_Struct &spell = sp[i];
+
+		memcpy(effectid[i], spell.effectid, sizeof(effectid[i]));
+		memcpy(base1[i], spell.base, sizeof(base1[i]));
+		memcpy(base2[i], spell.base2, sizeof(base2[i]));
+		memcpy(max[i], spell.max, sizeof(max[i]));
+		memcpy(effect_mask[i], spell.effect_mask, sizeof(effect_mask[i]));
+		resisttype[i] = static_cast<int16>(spell.resisttype);
+		targettype[i] = static_cast<uint8>(spell.targettype);
+
+		uint8 f = 0;
+		// same rules as IsValidSpell
+		if (i != 0 && i != 1 && spell.player_1[0]) {
+			f |= SPELL_HOT_VALID;
+			if (IsBeneficialSpellRecord(spell))
+				f |= SPELL_HOT_BENEFICIAL;
+			if (spell.classes[BARD - 1] < 255 && !spell.IsDisciplineBuff)
+				f |= SPELL_HOT_BARD_SONG;
+		}
+		flags[i] = f;
+	}
+}
+
+void MapSpellHotView(const void *data, int records, SPDat_Spell_Hot *view)
+{
+	SpellHotOffsets o = GetSpellHotOffsets(records);
+	const char *base = reinterpret_cast<const char*>(data);
+
+	view->records = records;
+	view->effectid = reinterpret_cast<const int32(*)[EFFECT_COUNT]>(base + o.effectid);
+	view->base = reinterpret_cast<const int32(*)[EFFECT_COUNT]>(base + o.base);
+	view->base2 = reinterpret_cast<const int32(*)[EFFECT_COUNT]>(base + o.base2);
+	view->max = reinterpret_cast<const int32(*)[EFFECT_COUNT]>(base + o.max);
+	view->effect_mask = reinterpret_cast<const uint32(*)[SPELL_EFFECT_MASK_WORDS]>(base + o.effect_mask);
+	view->resisttype = reinterpret_cast<const int16*>(base + o.resisttype);
+	view->targettype = reinterpret_cast<const uint8*>(base + o.targettype);
+	view->flags = reinterpret_cast<const uint8*>(base + o.flags);
+}
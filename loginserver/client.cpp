@@ -24,8 +24,10 @@
 #include "../common/eqemu_logsys.h"
 #include "../common/string_util.h"
 #include "encryption.h"
+#include "../common/event/task_scheduler.h"
 
-extern LoginServer server;
+extern LoginServer              server;
+extern EQ::Event::TaskScheduler task_runner;
 
 /**
  * @param c
@@ -39,10 +41,31 @@ Client::Client(std::shared_ptr<EQStreamInterface> c, LSClientVersion v)
 	account_id       = 0;
 	play_server_id   = 0;
 	play_sequence_id = 0;
+
+	pending_verification_account_id = 0;
+}
+
+Client::~Client()
+{
+	/**
+	 * The worker still finishes the hash, the address keeps its slot until it does
+	 */
+	if (pending_verification.valid()) {
+		server.client_manager->AbandonPasswordVerification(
+			pending_verification_ip,
+			std::move(pending_verification),
+			pending_verification_start
+		);
+	}
 }
 
 bool Client::Process()
 {
+	if (status == cs_verifying_login && pending_verification.valid() &&
+		pending_verification.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+		FinishLoginVerification();
+	}
+
 	EQApplicationPacket *app = connection->PopPacket();
 	while (app) {
 		if (server.options.IsTraceOn()) {
@@ -262,9 +285,9 @@ void Client::Handle_Login(const char *data, unsigned int size)
 			ParseAccountString(user, user, db_loginserver);
 
 			if (server.db->GetLoginDataFromAccountInfo(user, db_loginserver, db_account_password_hash, db_account_id)) {
-				result = VerifyLoginHash(user, db_loginserver, cred, db_account_password_hash);
+				BeginLoginVerification(user, db_loginserver, cred, db_account_password_hash, db_account_id);
 
-				LogDebug("[VerifyLoginHash] Success [{0}]", (result ? "true" : "false"));
+				return;
 			}
 			else {
 				status = cs_creating_account;
@@ -484,85 +507,182 @@ void Client::DoFailedLogin()
 }
 
 /**
- * Verifies a login hash, will also attempt to update a login hash if needed
+ * Verifies a login hash, will also produce an upgraded hash for insecure passwords if needed
+ *
+ * Runs on the task scheduler so it must not touch the database or any client state
  *
  * @param account_username
- * @param source_loginserver
  * @param account_password
  * @param password_hash
+ * @param encryption_mode
+ * @param update_insecure_passwords
  * @return
  */
-bool Client::VerifyLoginHash(
+LoginVerifyResult Client::VerifyLoginHash(
 	const std::string &account_username,
-	const std::string &source_loginserver,
 	const std::string &account_password,
-	const std::string &password_hash
+	const std::string &password_hash,
+	int encryption_mode,
+	bool update_insecure_passwords
 )
 {
-	auto encryption_mode = server.options.GetEncryptionMode();
+	LoginVerifyResult result;
+	result.success                         = false;
+	result.insecure_source_encryption_mode = 0;
+	result.encryption_mode                 = encryption_mode;
+
 	if (eqcrypt_verify_hash(account_username, account_password, password_hash, encryption_mode)) {
-		return true;
+		result.success = true;
+		return result;
 	}
-	else {
-		if (server.options.IsUpdatingInsecurePasswords()) {
-			if (encryption_mode < EncryptionModeArgon2) {
-				encryption_mode = EncryptionModeArgon2;
-			}
 
-			uint32 insecure_source_encryption_mode = 0;
-			if (password_hash.length() == CryptoHash::md5_hash_length) {
-				for (int i = EncryptionModeMD5; i <= EncryptionModeMD5Triple; ++i) {
-					if (i != encryption_mode &&
-						eqcrypt_verify_hash(account_username, account_password, password_hash, i)) {
-						insecure_source_encryption_mode = i;
-					}
-				}
+	if (!update_insecure_passwords) {
+		return result;
+	}
+
+	if (encryption_mode < EncryptionModeArgon2) {
+		encryption_mode = EncryptionModeArgon2;
+	}
+
+	int insecure_source_encryption_mode = 0;
+	if (password_hash.length() == CryptoHash::md5_hash_length) {
+		for (int i = EncryptionModeMD5; i <= EncryptionModeMD5Triple; ++i) {
+			if (i != encryption_mode &&
+				eqcrypt_verify_hash(account_username, account_password, password_hash, i)) {
+				insecure_source_encryption_mode = i;
 			}
-			else if (password_hash.length() == CryptoHash::sha1_hash_length && insecure_source_encryption_mode == 0) {
-				for (int i = EncryptionModeSHA; i <= EncryptionModeSHATriple; ++i) {
-					if (i != encryption_mode &&
-						eqcrypt_verify_hash(account_username, account_password, password_hash, i)) {
-						insecure_source_encryption_mode = i;
-					}
-				}
+		}
+	}
+	else if (password_hash.length() == CryptoHash::sha1_hash_length && insecure_source_encryption_mode == 0) {
+		for (int i = EncryptionModeSHA; i <= EncryptionModeSHATriple; ++i) {
+			if (i != encryption_mode &&
+				eqcrypt_verify_hash(account_username, account_password, password_hash, i)) {
+				insecure_source_encryption_mode = i;
 			}
-			else if (password_hash.length() == CryptoHash::sha512_hash_length && insecure_source_encryption_mode == 0) {
-				for (int i = EncryptionModeSHA512; i <= EncryptionModeSHA512Triple; ++i) {
-					if (i != encryption_mode &&
-						eqcrypt_verify_hash(account_username, account_password, password_hash, i)) {
-						insecure_source_encryption_mode = i;
-					}
-				}
+		}
+	}
+	else if (password_hash.length() == CryptoHash::sha512_hash_length && insecure_source_encryption_mode == 0) {
+		for (int i = EncryptionModeSHA512; i <= EncryptionModeSHA512Triple; ++i) {
+			if (i != encryption_mode &&
+				eqcrypt_verify_hash(account_username, account_password, password_hash, i)) {
+				insecure_source_encryption_mode = i;
 			}
+		}
+	}
 
-			if (insecure_source_encryption_mode > 0) {
-				LogInfo(
-					"[{}] Updated insecure password user [{}] loginserver [{}] from mode [{}] ({}) to mode [{}] ({})",
-					__func__,
-					account_username,
-					source_loginserver,
-					GetEncryptionByModeId(insecure_source_encryption_mode),
-					insecure_source_encryption_mode,
-					GetEncryptionByModeId(encryption_mode),
-					encryption_mode
-				);
+	if (insecure_source_encryption_mode > 0) {
+		result.success                         = true;
+		result.insecure_source_encryption_mode = insecure_source_encryption_mode;
+		result.encryption_mode                 = encryption_mode;
+		result.updated_password_hash           = eqcrypt_hash(account_username, account_password, encryption_mode);
+	}
 
-				server.db->UpdateLoginserverAccountPasswordHash(
-					account_username,
-					source_loginserver,
-					eqcrypt_hash(
-						account_username,
-						account_password,
-						encryption_mode
-					)
-				);
+	return result;
+}
 
-				return true;
-			}
+/**
+ * @param account_username
+ * @param source_loginserver
+ * @param account_password
+ * @param password_hash
+ * @param db_account_id
+ */
+void Client::BeginLoginVerification(
+	const std::string &account_username,
+	const std::string &source_loginserver,
+	const std::string &account_password,
+	const std::string &password_hash,
+	unsigned int db_account_id
+)
+{
+	std::string ip = connection->GetRemoteAddr();
+	if (!server.client_manager->BeginPasswordVerification(ip)) {
+		LogWarning(
+			"login [{0}] user [{1}] Login rejected, [{2}] already has [{3}] password checks pending",
+			source_loginserver,
+			account_username,
+			ip,
+			server.options.GetMaxPendingLoginsPerIP()
+		);
+
+		DoFailedLogin();
+		return;
+	}
+
+	status                           = cs_verifying_login;
+	pending_verification_user        = account_username;
+	pending_verification_loginserver = source_loginserver;
+	pending_verification_ip          = ip;
+	pending_verification_account_id  = db_account_id;
+	pending_verification_start       = std::chrono::steady_clock::now();
+
+	int  encryption_mode           = server.options.GetEncryptionMode();
+	bool update_insecure_passwords = server.options.IsUpdatingInsecurePasswords();
+
+	pending_verification = task_runner.Enqueue(
+		[account_username, account_password, password_hash, encryption_mode, update_insecure_passwords]() {
+			return VerifyLoginHash(
+				account_username,
+				account_password,
+				password_hash,
+				encryption_mode,
+				update_insecure_passwords
+			);
 		}
+	);
+}
+
+void Client::FinishLoginVerification()
+{
+	LoginVerifyResult result = pending_verification.get();
+
+	auto latency_ms = (uint64) std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::steady_clock::now() - pending_verification_start
+	).count();
+
+	server.client_manager->EndPasswordVerification(pending_verification_ip, latency_ms, true);
+
+	LogDebug("[VerifyLoginHash] Success [{0}] took [{1}] ms", (result.success ? "true" : "false"), latency_ms);
+
+	if (result.insecure_source_encryption_mode > 0) {
+		LogInfo(
+			"[{}] Updated insecure password user [{}] loginserver [{}] from mode [{}] ({}) to mode [{}] ({})",
+			__func__,
+			pending_verification_user,
+			pending_verification_loginserver,
+			GetEncryptionByModeId(result.insecure_source_encryption_mode),
+			result.insecure_source_encryption_mode,
+			GetEncryptionByModeId(result.encryption_mode),
+			result.encryption_mode
+		);
+
+		server.db->UpdateLoginserverAccountPasswordHash(
+			pending_verification_user,
+			pending_verification_loginserver,
+			result.updated_password_hash
+		);
+	}
+
+	status = cs_waiting_for_login;
+
+	if (result.success) {
+		LogInfo(
+			"login [{0}] user [{1}] Login succeeded",
+			pending_verification_loginserver,
+			pending_verification_user
+		);
+
+		DoSuccessfulLogin(pending_verification_user, pending_verification_account_id, pending_verification_loginserver);
 	}
+	else {
+		LogInfo(
+			"login [{0}] user [{1}] Login failed",
+			pending_verification_loginserver,
+			pending_verification_user
+		);
 
-	return false;
+		DoFailedLogin();
+	}
 }
 
 /**
@@ -29,16 +29,29 @@
 #include "../common/net/daybreak_connection.h"
 #include "login_structures.h"
 #include <memory>
+#include <future>
+#include <chrono>
 
 enum LSClientVersion {
 	cv_titanium,
 	cv_sod
 };
 
+/**
+ * Outcome of a password check run on the task scheduler
+ */
+struct LoginVerifyResult {
+	bool        success;
+	int         insecure_source_encryption_mode;
+	int         encryption_mode;
+	std::string updated_password_hash;
+};
+
 enum LSClientStatus {
 	cs_not_sent_session_ready,
 	cs_waiting_for_login,
 	cs_creating_account,
+	cs_verifying_login,
 	cs_failed_to_login,
 	cs_logged_in
 };
@@ -60,7 +73,7 @@ public:
 	/**
 	 * Destructor
 	 */
-	~Client() {}
+	~Client();
 
 	/**
 	 * Processes the client's connection and does various actions
@@ -175,21 +188,36 @@ public:
 	void DoFailedLogin();
 
 	/**
-	 * Verifies a login hash, will also attempt to update a login hash if needed
+	 * Safe to run off the main thread, touches neither the database nor the client
 	 *
 	 * @param account_username
-	 * @param source_loginserver
 	 * @param account_password
 	 * @param password_hash
+	 * @param encryption_mode
+	 * @param update_insecure_passwords
 	 * @return
 	 */
-	bool VerifyLoginHash(
+	static LoginVerifyResult VerifyLoginHash(
+		const std::string &account_username,
+		const std::string &account_password,
+		const std::string &password_hash,
+		int encryption_mode,
+		bool update_insecure_passwords
+	);
+
+	/**
+	 * Hands the password check to the task scheduler, the login finishes from Process once it is done
+	 */
+	void BeginLoginVerification(
 		const std::string &account_username,
 		const std::string &source_loginserver,
 		const std::string &account_password,
-		const std::string &password_hash
+		const std::string &password_hash,
+		unsigned int db_account_id
 	);
 
+	void FinishLoginVerification();
+
 	void DoSuccessfulLogin(const std::string in_account_name, int db_account_id, const std::string &db_loginserver);
 	void CreateLocalAccount(const std::string &username, const std::string &password);
 	void CreateEQEmuAccount(const std::string &in_account_name, const std::string &in_account_password, unsigned int loginserver_account_id);
@@ -213,6 +241,14 @@ private:
 
 	std::string stored_user;
 	std::string stored_pass;
+
+	std::future<LoginVerifyResult>        pending_verification;
+	std::string                           pending_verification_user;
+	std::string                           pending_verification_loginserver;
+	std::string                           pending_verification_ip;
+	unsigned int                          pending_verification_account_id;
+	std::chrono::steady_clock::time_point pending_verification_start;
+
 	void LoginOnNewConnection(std::shared_ptr<EQ::Net::DaybreakConnection> connection);
 	void LoginOnStatusChange(
 		std::shared_ptr<EQ::Net::DaybreakConnection> conn,
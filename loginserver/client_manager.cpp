@@ -28,6 +28,8 @@ extern bool        run_server;
 
 ClientManager::ClientManager()
 {
+	verification_stats = VerificationStats{};
+
 	int titanium_port = server.config.GetVariableInt("client_configuration", "titanium_port", 5998);
 
 	EQStreamManagerInterfaceOptions titanium_opts(titanium_port, false, false);
@@ -121,6 +123,7 @@ ClientManager::~ClientManager()
 void ClientManager::Process()
 {
 	ProcessDisconnect();
+	ProcessAbandonedVerifications();
 
 	auto iter = clients.begin();
 	while (iter != clients.end()) {
@@ -187,3 +190,98 @@ Client *ClientManager::GetClient(unsigned int account_id, const std::string &log
 
 	return nullptr;
 }
+
+/**
+ * @param ip
+ * @return
+ */
+bool ClientManager::BeginPasswordVerification(const std::string &ip)
+{
+	int max_pending = server.options.GetMaxPendingLoginsPerIP();
+	int &pending    = pending_verifications[ip];
+
+	if (max_pending > 0 && pending >= max_pending) {
+		if (pending == 0) {
+			pending_verifications.erase(ip);
+		}
+
+		verification_stats.rejected++;
+		return false;
+	}
+
+	pending++;
+	verification_stats.started++;
+	verification_stats.in_flight++;
+
+	return true;
+}
+
+/**
+ * @param ip
+ * @param verification
+ * @param start
+ */
+void ClientManager::AbandonPasswordVerification(
+	const std::string &ip,
+	std::future<LoginVerifyResult> &&verification,
+	std::chrono::steady_clock::time_point start
+)
+{
+	AbandonedVerification abandoned;
+	abandoned.ip     = ip;
+	abandoned.result = std::move(verification);
+	abandoned.start  = start;
+
+	abandoned_verifications.push_back(std::move(abandoned));
+}
+
+void ClientManager::ProcessAbandonedVerifications()
+{
+	auto iter = abandoned_verifications.begin();
+	while (iter != abandoned_verifications.end()) {
+		if (iter->result.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+			++iter;
+			continue;
+		}
+
+		EndPasswordVerification(
+			iter->ip,
+			(uint64) std::chrono::duration_cast<std::chrono::milliseconds>(
+				std::chrono::steady_clock::now() - iter->start
+			).count(),
+			false
+		);
+
+		iter = abandoned_verifications.erase(iter);
+	}
+}
+
+/**
+ * @param ip
+ * @param latency_ms
+ * @param completed
+ */
+void ClientManager::EndPasswordVerification(const std::string &ip, uint64 latency_ms, bool completed)
+{
+	auto iter = pending_verifications.find(ip);
+	if (iter != pending_verifications.end()) {
+		if (--iter->second <= 0) {
+			pending_verifications.erase(iter);
+		}
+	}
+
+	if (verification_stats.in_flight > 0) {
+		verification_stats.in_flight--;
+	}
+
+	if (!completed) {
+		verification_stats.abandoned++;
+		return;
+	}
+
+	verification_stats.completed++;
+	verification_stats.total_latency_ms += latency_ms;
+	if (latency_ms > verification_stats.max_latency_ms) {
+		verification_stats.max_latency_ms = latency_ms;
+	}
+}
@@ -26,6 +26,7 @@
 #include "../common/net/eqstream.h"
 #include "client.h"
 #include <list>
+#include <map>
 
 /**
 * Client manager class, holds all the client objects and does basic processing.
@@ -63,6 +64,46 @@ public:
 	 * @return
 	 */
 	Client *GetClient(unsigned int account_id, const std::string &loginserver);
+
+	struct VerificationStats {
+		uint64 started;
+		uint64 completed;
+		uint64 rejected;
+		uint64 abandoned;
+		uint64 total_latency_ms;
+		uint64 max_latency_ms;
+		uint32 in_flight;
+	};
+
+	/**
+	 * Claims a password check slot for an address, false when it already has the configured maximum running
+	 *
+	 * @param ip
+	 * @return
+	 */
+	bool BeginPasswordVerification(const std::string &ip);
+
+	/**
+	 * @param ip
+	 * @param latency_ms queue wait plus hashing time
+	 * @param completed false when the client went away before the result was used
+	 */
+	void EndPasswordVerification(const std::string &ip, uint64 latency_ms, bool completed);
+
+	/**
+	 * Takes over a password check whose client went away, the address keeps its slot until the worker is done hashing
+	 *
+	 * @param ip
+	 * @param verification
+	 * @param start
+	 */
+	void AbandonPasswordVerification(
+		const std::string &ip,
+		std::future<LoginVerifyResult> &&verification,
+		std::chrono::steady_clock::time_point start
+	);
+
+	const VerificationStats &GetVerificationStats() const { return verification_stats; }
 private:
 
 	/**
@@ -70,7 +111,21 @@ private:
 	 */
 	void ProcessDisconnect();
 
+	/**
+	 * Releases the slots of abandoned password checks that have finished
+	 */
+	void ProcessAbandonedVerifications();
+
+	struct AbandonedVerification {
+		std::string                           ip;
+		std::future<LoginVerifyResult>        result;
+		std::chrono::steady_clock::time_point start;
+	};
+
 	std::list<Client *>      clients;
+	std::map<std::string, int> pending_verifications;
+	std::list<AbandonedVerification> abandoned_verifications;
+	VerificationStats        verification_stats;
 	OpcodeManager            *titanium_ops;
 	EQ::Net::EQStreamManager *titanium_stream;
 	OpcodeManager            *sod_ops;
@@ -67,6 +67,29 @@ namespace LoginserverWebserver {
 			}
 		);
 
+		api.Get(
+			"/v1/logins/stats", [](const httplib::Request &request, httplib::Response &res) {
+				if (!LoginserverWebserver::TokenManager::AuthCanRead(request, res)) {
+					return;
+				}
+
+				auto &stats = server.client_manager->GetVerificationStats();
+
+				Json::Value response;
+				response["verifications_started"]   = (Json::UInt64) stats.started;
+				response["verifications_completed"] = (Json::UInt64) stats.completed;
+				response["verifications_rejected"]  = (Json::UInt64) stats.rejected;
+				response["verifications_abandoned"] = (Json::UInt64) stats.abandoned;
+				response["verifications_in_flight"] = stats.in_flight;
+				response["average_latency_ms"]      = (Json::UInt64) (
+					stats.completed > 0 ? stats.total_latency_ms / stats.completed : 0
+				);
+				response["max_latency_ms"]          = (Json::UInt64) stats.max_latency_ms;
+
+				LoginserverWebserver::SendResponse(response, res);
+			}
+		);
+
 		api.Post(
 			"/v1/account/create", [](const httplib::Request &request, httplib::Response &res) {
 				if (!LoginserverWebserver::TokenManager::AuthCanWrite(request, res)) {
@@ -70,6 +70,12 @@ void LoadServerConfig()
 	server.options.WorldTrace(server.config.GetVariableBool("logging", "world_trace", false));
 	server.options.DumpInPackets(server.config.GetVariableBool("logging", "dump_packets_in", false));
 	server.options.DumpOutPackets(server.config.GetVariableBool("logging", "dump_packets_out", false));
+	LogSys.SetFileLogOptions(
+		server.config.GetVariableBool("logging", "async_file_logs", true),
+		static_cast<uint32>(server.config.GetVariableInt("logging", "async_file_log_queue_size", 8192)),
+		server.config.GetVariableBool("logging", "async_file_log_block_when_full", false),
+		server.config.GetVariableBool("logging", "binary_file_logs", false)
+	);
 
 	/**
 	 * Worldservers
@@ -121,6 +127,7 @@ void LoadServerConfig()
 
 	server.options.AllowTokenLogin(server.config.GetVariableBool("security", "allow_token_login", false));
 	server.options.AllowPasswordLogin(server.config.GetVariableBool("security", "allow_password_login", true));
+	server.options.MaxPendingLoginsPerIP(server.config.GetVariableInt("security", "max_pending_logins_per_ip", 3));
 	server.options.UpdateInsecurePasswords(
 		server.config.GetVariableBool(
 			"security",
@@ -244,6 +251,7 @@ int main(int argc, char **argv)
 	LogInfo("[Config] [Security] IsTokenLoginAllowed [{0}]", server.options.IsTokenLoginAllowed());
 	LogInfo("[Config] [Security] IsPasswordLoginAllowed [{0}]", server.options.IsPasswordLoginAllowed());
 	LogInfo("[Config] [Security] IsUpdatingInsecurePasswords [{0}]", server.options.IsUpdatingInsecurePasswords());
+	LogInfo("[Config] [Security] GetMaxPendingLoginsPerIP [{0}]", server.options.GetMaxPendingLoginsPerIP());
 
 	while (run_server) {
 		Timer::SetCurrentTime();
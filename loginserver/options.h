@@ -40,7 +40,8 @@ public:
 		reject_duplicate_servers(false),
 		allow_password_login(true),
 		allow_token_login(false),
-		auto_create_accounts(false) {}
+		auto_create_accounts(false),
+		max_pending_logins_per_ip(3) {}
 
 	/**
 	* Sets allow_unregistered.
@@ -133,6 +134,12 @@ public:
 	inline void UpdateInsecurePasswords(bool b) { update_insecure_passwords = b; }
 	inline bool IsUpdatingInsecurePasswords() const { return update_insecure_passwords; }
 
+	/**
+	* Password checks one address may have running on the task scheduler at once
+	*/
+	inline void MaxPendingLoginsPerIP(int v) { max_pending_logins_per_ip = v; }
+	inline int GetMaxPendingLoginsPerIP() const { return max_pending_logins_per_ip; }
+
 private:
 	bool        allow_unregistered;
 	bool        trace;
@@ -146,6 +153,7 @@ private:
 	bool        auto_link_accounts;
 	bool        update_insecure_passwords;
 	int         encryption_mode;
+	int         max_pending_logins_per_ip;
 	std::string eqemu_loginserver_address;
 	std::string default_loginserver_name;
 };
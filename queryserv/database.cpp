@@ -31,6 +31,8 @@
 #include <assert.h>
 #include <map>
 #include <vector>
+#include <algorithm>
+#include <time.h>
 
 // Disgrace: for windows compile
 #ifdef _WINDOWS
@@ -49,6 +51,7 @@
 #include "../common/eq_packet_structs.h"
 #include "../common/string_util.h"
 #include "../common/servertalk.h"
+#include "../common/timer.h"
 
 Database::Database()
 {
@@ -77,13 +80,85 @@ bool Database::Connect(const char *host, const char *user, const char *passwd, c
 	}
 	else {
 		LogInfo("Using database [{}] at [{}]:[{}]", database, host, port);
+
+		/* Batched record ids are derived from the first generated id, so honor the server's step */
+		auto results = QueryDatabase("SELECT @@auto_increment_increment");
+		if (results.Success() && results.RowCount() == 1) {
+			auto row = results.begin();
+			auto_increment_increment = std::max(1, atoi(row[0]));
+		}
+
 		return true;
 	}
 }
 
 void Database::DBInitVars()
 {
-
+	pending_rows             = 0;
+	last_flush               = 0;
+	auto_increment_increment = 1;
+
+	event_batches[BatchSpeech]   = {
+		"Speech", "qs_player_speech",
+		"`from`, `to`, `message`, `minstatus`, `guilddbid`, `type`, `timerecorded`", "",
+		nullptr, nullptr
+	};
+	event_batches[BatchDrop]     = {
+		"Drop", "qs_player_drop_record",
+		"`time`, `char_id`, `pickup`, `zone_id`, `x`, `y`, `z`", "",
+		"qs_player_drop_record_entries",
+		"`item_id`, `charges`, `aug_1`, `aug_2`, `aug_3`, `aug_4`, `aug_5`"
+	};
+	event_batches[BatchTrade]    = {
+		"Trade", "qs_player_trade_record",
+		"`time`, `char1_id`, `char1_pp`, `char1_gp`, `char1_sp`, `char1_cp`, `char1_items`, "
+		"`char2_id`, `char2_pp`, `char2_gp`, `char2_sp`, `char2_cp`, `char2_items`", "",
+		"qs_player_trade_record_entries",
+		"`from_id`, `from_slot`, `to_id`, `to_slot`, `item_id`, `charges`, "
+		"`aug_1`, `aug_2`, `aug_3`, `aug_4`, `aug_5`"
+	};
+	event_batches[BatchHandin]   = {
+		"Handin", "qs_player_handin_record",
+		"`time`, `quest_id`, `char_id`, `char_pp`, `char_gp`, `char_sp`, `char_cp`, `char_items`, "
+		"`npc_id`, `npc_pp`, `npc_gp`, `npc_sp`, `npc_cp`, `npc_items`", "",
+		"qs_player_handin_record_entries",
+		"`action_type`, `char_slot`, `item_id`, `charges`, `aug_1`, `aug_2`, `aug_3`, `aug_4`, `aug_5`"
+	};
+	event_batches[BatchNPCKill]  = {
+		"NPC Kill", "qs_player_npc_kill_record",
+		"`npc_id`, `type`, `zone_id`, `time`", "",
+		"qs_player_npc_kill_record_entries",
+		"`char_id`"
+	};
+	event_batches[BatchDelete]   = {
+		"Delete", "qs_player_delete_record",
+		"`time`, `char_id`, `stack_size`, `char_items`", "",
+		"qs_player_delete_record_entries",
+		"`char_slot`, `item_id`, `charges`, `aug_1`, `aug_2`, `aug_3`, `aug_4`, `aug_5`"
+	};
+	event_batches[BatchMove]     = {
+		"Move", "qs_player_move_record",
+		"`time`, `char_id`, `from_slot`, `to_slot`, `stack_size`, `char_items`, `postaction`", "",
+		"qs_player_move_record_entries",
+		"`from_slot`, `to_slot`, `item_id`, `charges`, `aug_1`, `aug_2`, `aug_3`, `aug_4`, `aug_5`"
+	};
+	event_batches[BatchMerchant] = {
+		"Transaction", "qs_merchant_transaction_record",
+		"`time`, `zone_id`, `merchant_id`, `merchant_pp`, `merchant_gp`, `merchant_sp`, `merchant_cp`, "
+		"`merchant_items`, `char_id`, `char_pp`, `char_gp`, `char_sp`, `char_cp`, `char_items`", "",
+		"qs_merchant_transaction_record_entries",
+		"`char_slot`, `item_id`, `charges`, `aug_1`, `aug_2`, `aug_3`, `aug_4`, `aug_5`"
+	};
+	event_batches[BatchEvents]   = {
+		"Player Event", "qs_player_events",
+		"`event`, `char_id`, `event_desc`, `time`", "",
+		nullptr, nullptr
+	};
+	event_batches[BatchAARate]   = {
+		"AA Rate", "qs_player_aa_rate_hourly",
+		"`char_id`, `aa_count`, `hour_time`", " ON DUPLICATE KEY UPDATE `aa_count` = `aa_count` + VALUES(`aa_count`)",
+		nullptr, nullptr
+	};
 }
 
 
@@ -97,6 +172,7 @@ Close the connection to the database
 */
 Database::~Database()
 {
+	FlushEventBatches(true);
 }
 
 void Database::AddSpeech(
@@ -108,326 +184,214 @@ void Database::AddSpeech(
 	uint8 type
 )
 {
-
-	auto escapedFrom    = new char[strlen(from) * 2 + 1];
-	auto escapedTo      = new char[strlen(to) * 2 + 1];
-	auto escapedMessage = new char[strlen(message) * 2 + 1];
-	DoEscapeString(escapedFrom, from, strlen(from));
-	DoEscapeString(escapedTo, to, strlen(to));
-	DoEscapeString(escapedMessage, message, strlen(message));
-
-	std::string query = StringFormat(
-		"INSERT INTO `qs_player_speech` "
-		"SET `from` = '%s', `to` = '%s', `message`='%s', "
-		"`minstatus`='%i', `guilddbid`='%i', `type`='%i'",
-		escapedFrom, escapedTo, escapedMessage, minstatus, guilddbid, type
+	AddBatchRecord(
+		BatchSpeech,
+		StringFormat(
+			"'%s', '%s', '%s', '%i', '%i', '%i', FROM_UNIXTIME(%u)",
+			EscapeString(from).c_str(), EscapeString(to).c_str(), EscapeString(message).c_str(),
+			minstatus, guilddbid, type, (uint32) time(nullptr)
+		)
 	);
-	safe_delete_array(escapedFrom);
-	safe_delete_array(escapedTo);
-	safe_delete_array(escapedMessage);
-	auto results = QueryDatabase(query);
-	if (!results.Success()) {
-		LogInfo("Failed Speech Entry Insert: [{}]", results.ErrorMessage().c_str());
-		LogInfo("[{}]", query.c_str());
-	}
-
-
 }
 
 void Database::LogPlayerDropItem(QSPlayerDropItem_Struct *QS)
 {
-
-	std::string query = StringFormat(
-		"INSERT INTO `qs_player_drop_record` SET `time` = NOW(), "
-		"`char_id` = '%i', `pickup` = '%i', "
-		"`zone_id` = '%i', `x` = '%i', `y` = '%i', `z` = '%i' ",
-		QS->char_id, QS->pickup, QS->zone_id, QS->x, QS->y, QS->z
+	uint32 record = AddBatchRecord(
+		BatchDrop,
+		StringFormat(
+			"FROM_UNIXTIME(%u), '%i', '%i', '%i', '%i', '%i', '%i'",
+			(uint32) time(nullptr), QS->char_id, QS->pickup, QS->zone_id, QS->x, QS->y, QS->z
+		)
 	);
 
-	auto results = QueryDatabase(query);
-	if (!results.Success()) {
-		LogInfo("Failed Drop Record Insert: [{}]", results.ErrorMessage().c_str());
-		LogInfo("[{}]", query.c_str());
-	}
-
-	if (QS->_detail_count == 0) {
-		return;
-	}
-
-	int lastIndex = results.LastInsertedID();
-
 	for (int i = 0; i < QS->_detail_count; i++) {
-		query   = StringFormat(
-			"INSERT INTO `qs_player_drop_record_entries` SET `event_id` = '%i', "
-			"`item_id` = '%i', `charges` = '%i', `aug_1` = '%i', `aug_2` = '%i', "
-			"`aug_3` = '%i', `aug_4` = '%i', `aug_5` = '%i'",
-			lastIndex, QS->items[i].item_id,
-			QS->items[i].charges, QS->items[i].aug_1, QS->items[i].aug_2,
-			QS->items[i].aug_3, QS->items[i].aug_4, QS->items[i].aug_5
+		AddBatchEntry(
+			BatchDrop,
+			record,
+			StringFormat(
+				"'%i', '%i', '%i', '%i', '%i', '%i', '%i'",
+				QS->items[i].item_id, QS->items[i].charges, QS->items[i].aug_1, QS->items[i].aug_2,
+				QS->items[i].aug_3, QS->items[i].aug_4, QS->items[i].aug_5
+			)
 		);
-		results = QueryDatabase(query);
-		if (!results.Success()) {
-			LogInfo("Failed Drop Record Entry Insert: [{}]", results.ErrorMessage().c_str());
-			LogInfo("[{}]", query.c_str());
-		}
 	}
 }
 
 void Database::LogPlayerTrade(QSPlayerLogTrade_Struct *QS, uint32 detailCount)
 {
-
-	std::string query   = StringFormat(
-		"INSERT INTO `qs_player_trade_record` SET `time` = NOW(), "
-		"`char1_id` = '%i', `char1_pp` = '%i', `char1_gp` = '%i', "
-		"`char1_sp` = '%i', `char1_cp` = '%i', `char1_items` = '%i', "
-		"`char2_id` = '%i', `char2_pp` = '%i', `char2_gp` = '%i', "
-		"`char2_sp` = '%i', `char2_cp` = '%i', `char2_items` = '%i'",
-		QS->char1_id, QS->char1_money.platinum, QS->char1_money.gold,
-		QS->char1_money.silver, QS->char1_money.copper, QS->char1_count,
-		QS->char2_id, QS->char2_money.platinum, QS->char2_money.gold,
-		QS->char2_money.silver, QS->char2_money.copper, QS->char2_count
+	uint32 record = AddBatchRecord(
+		BatchTrade,
+		StringFormat(
+			"FROM_UNIXTIME(%u), '%i', '%i', '%i', '%i', '%i', '%i', "
+			"'%i', '%i', '%i', '%i', '%i', '%i'",
+			(uint32) time(nullptr),
+			QS->char1_id, QS->char1_money.platinum, QS->char1_money.gold,
+			QS->char1_money.silver, QS->char1_money.copper, QS->char1_count,
+			QS->char2_id, QS->char2_money.platinum, QS->char2_money.gold,
+			QS->char2_money.silver, QS->char2_money.copper, QS->char2_count
+		)
 	);
-	auto        results = QueryDatabase(query);
-	if (!results.Success()) {
-		LogInfo("Failed Trade Log Record Insert: [{}]", results.ErrorMessage().c_str());
-		LogInfo("[{}]", query.c_str());
-	}
-
-	if (detailCount == 0) {
-		return;
-	}
-
-	int lastIndex = results.LastInsertedID();
 
 	for (int i = 0; i < detailCount; i++) {
-		query   = StringFormat(
-			"INSERT INTO `qs_player_trade_record_entries` SET `event_id` = '%i', "
-			"`from_id` = '%i', `from_slot` = '%i', `to_id` = '%i', `to_slot` = '%i', "
-			"`item_id` = '%i', `charges` = '%i', `aug_1` = '%i', `aug_2` = '%i', "
-			"`aug_3` = '%i', `aug_4` = '%i', `aug_5` = '%i'",
-			lastIndex, QS->items[i].from_id, QS->items[i].from_slot,
-			QS->items[i].to_id, QS->items[i].to_slot, QS->items[i].item_id,
-			QS->items[i].charges, QS->items[i].aug_1, QS->items[i].aug_2,
-			QS->items[i].aug_3, QS->items[i].aug_4, QS->items[i].aug_5
+		AddBatchEntry(
+			BatchTrade,
+			record,
+			StringFormat(
+				"'%i', '%i', '%i', '%i', '%i', '%i', '%i', '%i', '%i', '%i', '%i'",
+				QS->items[i].from_id, QS->items[i].from_slot,
+				QS->items[i].to_id, QS->items[i].to_slot, QS->items[i].item_id,
+				QS->items[i].charges, QS->items[i].aug_1, QS->items[i].aug_2,
+				QS->items[i].aug_3, QS->items[i].aug_4, QS->items[i].aug_5
+			)
 		);
-		results = QueryDatabase(query);
-		if (!results.Success()) {
-			LogInfo("Failed Trade Log Record Entry Insert: [{}]", results.ErrorMessage().c_str());
-			LogInfo("[{}]", query.c_str());
-		}
-
 	}
-
 }
 
 void Database::LogPlayerHandin(QSPlayerLogHandin_Struct *QS, uint32 detailCount)
 {
-
-	std::string query   = StringFormat(
-		"INSERT INTO `qs_player_handin_record` SET `time` = NOW(), "
-		"`quest_id` = '%i', `char_id` = '%i', `char_pp` = '%i', "
-		"`char_gp` = '%i', `char_sp` = '%i', `char_cp` = '%i', "
-		"`char_items` = '%i', `npc_id` = '%i', `npc_pp` = '%i', "
-		"`npc_gp` = '%i', `npc_sp` = '%i', `npc_cp` = '%i', "
-		"`npc_items`='%i'",
-		QS->quest_id, QS->char_id, QS->char_money.platinum,
-		QS->char_money.gold, QS->char_money.silver, QS->char_money.copper,
-		QS->char_count, QS->npc_id, QS->npc_money.platinum,
-		QS->npc_money.gold, QS->npc_money.silver, QS->npc_money.copper,
-		QS->npc_count
+	uint32 record = AddBatchRecord(
+		BatchHandin,
+		StringFormat(
+			"FROM_UNIXTIME(%u), '%i', '%i', '%i', '%i', '%i', '%i', '%i', "
+			"'%i', '%i', '%i', '%i', '%i', '%i'",
+			(uint32) time(nullptr),
+			QS->quest_id, QS->char_id, QS->char_money.platinum,
+			QS->char_money.gold, QS->char_money.silver, QS->char_money.copper,
+			QS->char_count, QS->npc_id, QS->npc_money.platinum,
+			QS->npc_money.gold, QS->npc_money.silver, QS->npc_money.copper,
+			QS->npc_count
+		)
 	);
-	auto        results = QueryDatabase(query);
-	if (!results.Success()) {
-		LogInfo("Failed Handin Log Record Insert: [{}]", results.ErrorMessage().c_str());
-		LogInfo("[{}]", query.c_str());
-	}
-
-	if (detailCount == 0) {
-		return;
-	}
-
-	int lastIndex = results.LastInsertedID();
 
 	for (int i = 0; i < detailCount; i++) {
-		query = StringFormat(
-			"INSERT INTO `qs_player_handin_record_entries` SET `event_id` = '%i', "
-			"`action_type` = '%s', `char_slot` = '%i', `item_id` = '%i', "
-			"`charges` = '%i', `aug_1` = '%i', `aug_2` = '%i', `aug_3` = '%i', "
-			"`aug_4` = '%i', `aug_5` = '%i'",
-			lastIndex, QS->items[i].action_type, QS->items[i].char_slot,
-			QS->items[i].item_id, QS->items[i].charges, QS->items[i].aug_1,
-			QS->items[i].aug_2, QS->items[i].aug_3, QS->items[i].aug_4,
-			QS->items[i].aug_5
+		std::string action_type(QS->items[i].action_type, strnlen(QS->items[i].action_type, sizeof(QS->items[i].action_type)));
+		AddBatchEntry(
+			BatchHandin,
+			record,
+			StringFormat(
+				"'%s', '%i', '%i', '%i', '%i', '%i', '%i', '%i', '%i'",
+				EscapeString(action_type).c_str(), QS->items[i].char_slot,
+				QS->items[i].item_id, QS->items[i].charges, QS->items[i].aug_1,
+				QS->items[i].aug_2, QS->items[i].aug_3, QS->items[i].aug_4,
+				QS->items[i].aug_5
+			)
 		);
-		if (!results.Success()) {
-			LogInfo("Failed Handin Log Record Entry Insert: [{}]", results.ErrorMessage().c_str());
-			LogInfo("[{}]", query.c_str());
-		}
 	}
-
 }
 
 void Database::LogPlayerNPCKill(QSPlayerLogNPCKill_Struct *QS, uint32 members)
 {
-
-	std::string query   = StringFormat(
-		"INSERT INTO `qs_player_npc_kill_record` "
-		"SET `npc_id` = '%i', `type` = '%i', "
-		"`zone_id` = '%i', `time` = NOW()",
-		QS->s1.NPCID, QS->s1.Type, QS->s1.ZoneID
+	uint32 record = AddBatchRecord(
+		BatchNPCKill,
+		StringFormat(
+			"'%i', '%i', '%i', FROM_UNIXTIME(%u)",
+			QS->s1.NPCID, QS->s1.Type, QS->s1.ZoneID, (uint32) time(nullptr)
+		)
 	);
-	auto        results = QueryDatabase(query);
-	if (!results.Success()) {
-		LogInfo("Failed NPC Kill Log Record Insert: [{}]", results.ErrorMessage().c_str());
-		LogInfo("[{}]", query.c_str());
-	}
-
-	if (members == 0) {
-		return;
-	}
-
-	int lastIndex = results.LastInsertedID();
 
 	for (int i = 0; i < members; i++) {
-		query = StringFormat(
-			"INSERT INTO `qs_player_npc_kill_record_entries` "
-			"SET `event_id` = '%i', `char_id` = '%i'",
-			lastIndex, QS->Chars[i].char_id
-		);
-		auto results = QueryDatabase(query);
-		if (!results.Success()) {
-			LogInfo("Failed NPC Kill Log Entry Insert: [{}]", results.ErrorMessage().c_str());
-			LogInfo("[{}]", query.c_str());
-		}
-
+		AddBatchEntry(BatchNPCKill, record, StringFormat("'%i'", QS->Chars[i].char_id));
 	}
-
 }
 
 void Database::LogPlayerDelete(QSPlayerLogDelete_Struct *QS, uint32 items)
 {
-
-	std::string query   = StringFormat(
-		"INSERT INTO `qs_player_delete_record` SET `time` = NOW(), "
-		"`char_id` = '%i', `stack_size` = '%i', `char_items` = '%i'",
-		QS->char_id, QS->stack_size, QS->char_count, QS->char_count
+	uint32 record = AddBatchRecord(
+		BatchDelete,
+		StringFormat(
+			"FROM_UNIXTIME(%u), '%i', '%i', '%i'",
+			(uint32) time(nullptr), QS->char_id, QS->stack_size, QS->char_count
+		)
 	);
-	auto        results = QueryDatabase(query);
-	if (!results.Success()) {
-		LogInfo("Failed Delete Log Record Insert: [{}]", results.ErrorMessage().c_str());
-		LogInfo("[{}]", query.c_str());
-	}
-
-	if (items == 0) {
-		return;
-	}
-
-	int lastIndex = results.LastInsertedID();
 
 	for (int i = 0; i < items; i++) {
-		query   = StringFormat(
-			"INSERT INTO `qs_player_delete_record_entries` SET `event_id` = '%i', "
-			"`char_slot` = '%i', `item_id` = '%i', `charges` = '%i', `aug_1` = '%i', "
-			"`aug_2` = '%i', `aug_3` = '%i', `aug_4` = '%i', `aug_5` = '%i'",
-			lastIndex, QS->items[i].char_slot, QS->items[i].item_id, QS->items[i].charges,
-			QS->items[i].aug_1, QS->items[i].aug_2, QS->items[i].aug_3, QS->items[i].aug_4,
-			QS->items[i].aug_5
+		AddBatchEntry(
+			BatchDelete,
+			record,
+			StringFormat(
+				"'%i', '%i', '%i', '%i', '%i', '%i', '%i', '%i'",
+				QS->items[i].char_slot, QS->items[i].item_id, QS->items[i].charges,
+				QS->items[i].aug_1, QS->items[i].aug_2, QS->items[i].aug_3, QS->items[i].aug_4,
+				QS->items[i].aug_5
+			)
 		);
-		results = QueryDatabase(query);
-		if (!results.Success()) {
-			LogInfo("Failed Delete Log Record Entry Insert: [{}]", results.ErrorMessage().c_str());
-			LogInfo("[{}]", query.c_str());
-		}
-
 	}
-
 }
 
 void Database::LogPlayerMove(QSPlayerLogMove_Struct *QS, uint32 items)
 {
 	/* These are item moves */
-
-	std::string query   = StringFormat(
-		"INSERT INTO `qs_player_move_record` SET `time` = NOW(), "
-		"`char_id` = '%i', `from_slot` = '%i', `to_slot` = '%i', "
-		"`stack_size` = '%i', `char_items` = '%i', `postaction` = '%i'",
-		QS->char_id, QS->from_slot, QS->to_slot, QS->stack_size,
-		QS->char_count, QS->postaction
+	uint32 record = AddBatchRecord(
+		BatchMove,
+		StringFormat(
+			"FROM_UNIXTIME(%u), '%i', '%i', '%i', '%i', '%i', '%i'",
+			(uint32) time(nullptr), QS->char_id, QS->from_slot, QS->to_slot, QS->stack_size,
+			QS->char_count, QS->postaction
+		)
 	);
-	auto        results = QueryDatabase(query);
-	if (!results.Success()) {
-		LogInfo("Failed Move Log Record Insert: [{}]", results.ErrorMessage().c_str());
-		LogInfo("[{}]", query.c_str());
-	}
-
-	if (items == 0) {
-		return;
-	}
-
-	int lastIndex = results.LastInsertedID();
 
 	for (int i = 0; i < items; i++) {
-		query   = StringFormat(
-			"INSERT INTO `qs_player_move_record_entries` SET `event_id` = '%i', "
-			"`from_slot` = '%i', `to_slot` = '%i', `item_id` = '%i', `charges` = '%i', "
-			"`aug_1` = '%i', `aug_2` = '%i', `aug_3` = '%i', `aug_4` = '%i', `aug_5` = '%i'",
-			lastIndex, QS->items[i].from_slot, QS->items[i].to_slot, QS->items[i].item_id,
-			QS->items[i].charges, QS->items[i].aug_1, QS->items[i].aug_2,
-			QS->items[i].aug_3, QS->items[i].aug_4, QS->items[i].aug_5
+		AddBatchEntry(
+			BatchMove,
+			record,
+			StringFormat(
+				"'%i', '%i', '%i', '%i', '%i', '%i', '%i', '%i', '%i'",
+				QS->items[i].from_slot, QS->items[i].to_slot, QS->items[i].item_id,
+				QS->items[i].charges, QS->items[i].aug_1, QS->items[i].aug_2,
+				QS->items[i].aug_3, QS->items[i].aug_4, QS->items[i].aug_5
+			)
 		);
-		results = QueryDatabase(query);
-		if (!results.Success()) {
-			LogInfo("Failed Move Log Record Entry Insert: [{}]", results.ErrorMessage().c_str());
-			LogInfo("[{}]", query.c_str());
-		}
 	}
 }
 
 void Database::LogMerchantTransaction(QSMerchantLogTransaction_Struct *QS, uint32 items)
 {
 	/* Merchant transactions are from the perspective of the merchant, not the player */
-	std::string query   = StringFormat(
-		"INSERT INTO `qs_merchant_transaction_record` SET `time` = NOW(), "
-		"`zone_id` = '%i', `merchant_id` = '%i', `merchant_pp` = '%i', "
-		"`merchant_gp` = '%i', `merchant_sp` = '%i', `merchant_cp` = '%i', "
-		"`merchant_items` = '%i', `char_id` = '%i', `char_pp` = '%i', "
-		"`char_gp` = '%i', `char_sp` = '%i', `char_cp` = '%i', "
-		"`char_items` = '%i'",
-		QS->zone_id, QS->merchant_id, QS->merchant_money.platinum,
-		QS->merchant_money.gold, QS->merchant_money.silver,
-		QS->merchant_money.copper, QS->merchant_count, QS->char_id,
-		QS->char_money.platinum, QS->char_money.gold, QS->char_money.silver,
-		QS->char_money.copper, QS->char_count
+	uint32 record = AddBatchRecord(
+		BatchMerchant,
+		StringFormat(
+			"FROM_UNIXTIME(%u), '%i', '%i', '%i', '%i', '%i', '%i', '%i', "
+			"'%i', '%i', '%i', '%i', '%i', '%i'",
+			(uint32) time(nullptr),
+			QS->zone_id, QS->merchant_id, QS->merchant_money.platinum,
+			QS->merchant_money.gold, QS->merchant_money.silver,
+			QS->merchant_money.copper, QS->merchant_count, QS->char_id,
+			QS->char_money.platinum, QS->char_money.gold, QS->char_money.silver,
+			QS->char_money.copper, QS->char_count
+		)
 	);
-	auto        results = QueryDatabase(query);
-	if (!results.Success()) {
-		LogInfo("Failed Transaction Log Record Insert: [{}]", results.ErrorMessage().c_str());
-		LogInfo("[{}]", query.c_str());
-	}
-
-	if (items == 0) {
-		return;
-	}
-
-	int lastIndex = results.LastInsertedID();
 
 	for (int i = 0; i < items; i++) {
-		query   = StringFormat(
-			"INSERT INTO `qs_merchant_transaction_record_entries` SET `event_id` = '%i', "
-			"`char_slot` = '%i', `item_id` = '%i', `charges` = '%i', `aug_1` = '%i', "
-			"`aug_2` = '%i', `aug_3` = '%i', `aug_4` = '%i', `aug_5` = '%i'",
-			lastIndex, QS->items[i].char_slot, QS->items[i].item_id, QS->items[i].charges,
-			QS->items[i].aug_1, QS->items[i].aug_2, QS->items[i].aug_3, QS->items[i].aug_4,
-			QS->items[i].aug_5
+		AddBatchEntry(
+			BatchMerchant,
+			record,
+			StringFormat(
+				"'%i', '%i', '%i', '%i', '%i', '%i', '%i', '%i'",
+				QS->items[i].char_slot, QS->items[i].item_id, QS->items[i].charges,
+				QS->items[i].aug_1, QS->items[i].aug_2, QS->items[i].aug_3, QS->items[i].aug_4,
+				QS->items[i].aug_5
+			)
 		);
-		results = QueryDatabase(query);
-		if (!results.Success()) {
-			LogInfo("Failed Transaction Log Record Entry Insert: [{}]", results.ErrorMessage().c_str());
-			LogInfo("[{}]", query.c_str());
-		}
-
 	}
+}
+
+void Database::LogPlayerEvent(QSPlayerLogEvent_Struct *QS, uint32 length)
+{
+	uint32 desc_length = std::min<uint32>(QS->event_desc_length, length - sizeof(QSPlayerLogEvent_Struct));
+	std::string event_desc(QS->event_desc, strnlen(QS->event_desc, desc_length));
+
+	AddBatchRecord(
+		BatchEvents,
+		StringFormat(
+			"%i, %i, '%s', %u",
+			QS->event_type, QS->char_id, EscapeString(event_desc).c_str(), QS->time
+		)
+	);
+}
 
+void Database::LogPlayerAARate(QSPlayerAARate_Struct *QS)
+{
+	AddBatchRecord(BatchAARate, StringFormat("%i, %i, %u", QS->char_id, QS->aa_count, QS->hour_time));
 }
 
 // this function does not delete the ServerPacket, so it must be handled at call site
@@ -449,6 +413,136 @@ void Database::GeneralQueryReceive(ServerPacket *pack)
 	safe_delete_array(queryBuffer);
 }
 
+/**
+ * @param type
+ * @param values
+ * @return index of the record in its batch, for AddBatchEntry
+ */
+uint32 Database::AddBatchRecord(EventBatchType type, const std::string &values)
+{
+	EventBatch &batch = event_batches[type];
+	batch.records.push_back(values);
+	pending_rows++;
+
+	return static_cast<uint32>(batch.records.size() - 1);
+}
+
+/**
+ * @param type
+ * @param record
+ * @param values
+ */
+void Database::AddBatchEntry(EventBatchType type, uint32 record, const std::string &values)
+{
+	event_batches[type].entries.push_back(std::make_pair(record, values));
+	pending_rows++;
+}
+
+/**
+ * @param force
+ */
+void Database::FlushEventBatches(bool force)
+{
+	if (pending_rows == 0) {
+		last_flush = Timer::GetCurrentTime();
+		return;
+	}
+
+	if (!force && pending_rows < QS_BATCH_MAX_ROWS && Timer::GetCurrentTime() - last_flush < QS_BATCH_FLUSH_INTERVAL) {
+		return;
+	}
+
+	TransactionBegin();
+	for (auto &batch : event_batches) {
+		FlushEventBatch(batch);
+	}
+	TransactionCommit();
+
+	pending_rows = 0;
+	last_flush   = Timer::GetCurrentTime();
+}
+
+/**
+ * @param batch
+ */
+void Database::FlushEventBatch(EventBatch &batch)
+{
+	if (batch.records.empty()) {
+		batch.entries.clear();
+		return;
+	}
+
+	/**
+	 * A multi-row insert hands out consecutive ids starting at the reported insert id, queryserv is the only writer
+	 */
+	std::vector<uint32> record_ids(batch.records.size(), 0);
+
+	for (size_t start = 0; start < batch.records.size(); start += QS_BATCH_ROWS_PER_INSERT) {
+		size_t end = std::min(batch.records.size(), start + QS_BATCH_ROWS_PER_INSERT);
+
+		std::string query = StringFormat("INSERT INTO `%s` (%s) VALUES ", batch.record_table, batch.record_columns);
+		for (size_t i = start; i < end; ++i) {
+			if (i != start) {
+				query += ", ";
+			}
+			query += "(" + batch.records[i] + ")";
+		}
+		query += batch.record_suffix;
+
+		auto results = QueryDatabase(query);
+		if (!results.Success()) {
+			LogInfo("Failed [{}] Record Insert: [{}]", batch.name, results.ErrorMessage().c_str());
+			LogInfo("[{}]", query.c_str());
+			continue;
+		}
+
+		uint32 first_id = results.LastInsertedID();
+		for (size_t i = start; i < end; ++i) {
+			record_ids[i] = first_id + static_cast<uint32>(i - start) * auto_increment_increment;
+		}
+	}
+
+	std::string query;
+	size_t      rows = 0;
+	for (size_t i = 0; i < batch.entries.size(); ++i) {
+		auto &entry = batch.entries[i];
+
+		/* Skip entries whose record didn't make it in */
+		if (record_ids[entry.first] == 0) {
+			continue;
+		}
+
+		if (rows == 0) {
+			query = StringFormat("INSERT INTO `%s` (`event_id`, %s) VALUES ", batch.entry_table, batch.entry_columns);
+		}
+		else {
+			query += ", ";
+		}
+
+		query += StringFormat("('%u', ", record_ids[entry.first]) + entry.second + ")";
+
+		if (++rows == QS_BATCH_ROWS_PER_INSERT || i + 1 == batch.entries.size()) {
+			auto results = QueryDatabase(query);
+			if (!results.Success()) {
+				LogInfo("Failed [{}] Record Entry Insert: [{}]", batch.name, results.ErrorMessage().c_str());
+				LogInfo("[{}]", query.c_str());
+			}
+			rows = 0;
+		}
+	}
+
+	if (rows > 0) {
+		auto results = QueryDatabase(query);
+		if (!results.Success()) {
+			LogInfo("Failed [{}] Record Entry Insert: [{}]", batch.name, results.ErrorMessage().c_str());
+			LogInfo("[{}]", query.c_str());
+		}
+	}
+
+	batch.records.clear();
+	batch.entries.clear();
+}
+
 void Database::LoadLogSettings(EQEmuLogSys::LogSettings *log_settings)
 {
 	std::string query =
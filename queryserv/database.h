@@ -23,6 +23,11 @@
 #define AUTHENTICATION_TIMEOUT	60
 #define INVALID_ID				0xFFFFFFFF
 
+/* Audit events are buffered and written as multi-row inserts once either threshold is hit */
+#define QS_BATCH_MAX_ROWS			250
+#define QS_BATCH_FLUSH_INTERVAL		1000
+#define QS_BATCH_ROWS_PER_INSERT	500
+
 #include "../common/eqemu_logsys.h"
 #include "../common/global_define.h"
 #include "../common/types.h"
@@ -32,6 +37,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <utility>
 
 //atoi is not uint32 or uint32 safe!!!!
 #define atoul(str) strtoul(str, nullptr, 10)
@@ -51,8 +57,13 @@ public:
 	void LogPlayerDelete(QSPlayerLogDelete_Struct* QS, uint32 Items);
 	void LogPlayerMove(QSPlayerLogMove_Struct* QS, uint32 Items);
 	void LogMerchantTransaction(QSMerchantLogTransaction_Struct* QS, uint32 Items);
+	void LogPlayerEvent(QSPlayerLogEvent_Struct* QS, uint32 Length);
+	void LogPlayerAARate(QSPlayerAARate_Struct* QS);
 	void GeneralQueryReceive(ServerPacket *pack);
 
+	/* Writes buffered events when a threshold is hit, or everything when force is set */
+	void FlushEventBatches(bool force = false);
+
 	void LoadLogSettings(EQEmuLogSys::LogSettings* log_settings);
 
 protected:
@@ -60,6 +71,43 @@ protected:
 private:
 	void DBInitVars();
 
+	/*
+		One batch per record table. Entry rows reference their record by index until the records are
+		inserted, then get the generated id as their event_id.
+	*/
+	struct EventBatch {
+		const char *name;
+		const char *record_table;
+		const char *record_columns;
+		const char *record_suffix;
+		const char *entry_table;
+		const char *entry_columns;
+		std::vector<std::string> records;
+		std::vector<std::pair<uint32, std::string>> entries;
+	};
+
+	enum EventBatchType {
+		BatchSpeech = 0,
+		BatchDrop,
+		BatchTrade,
+		BatchHandin,
+		BatchNPCKill,
+		BatchDelete,
+		BatchMove,
+		BatchMerchant,
+		BatchEvents,
+		BatchAARate,
+		BatchCount
+	};
+
+	uint32 AddBatchRecord(EventBatchType type, const std::string &values);
+	void AddBatchEntry(EventBatchType type, uint32 record, const std::string &values);
+	void FlushEventBatch(EventBatch &batch);
+
+	EventBatch event_batches[BatchCount];
+	uint32 pending_rows;
+	uint32 last_flush;
+	uint32 auto_increment_increment;
 };
 
 #endif
@@ -76,6 +76,7 @@ int main() {
 
 	/* Register Log System and Settings */
 	database.LoadLogSettings(LogSys.log_settings);
+	LogSys.SetFileLogOptions(Config->LogFileAsync, Config->LogFileQueueSize, Config->LogFileBlockWhenFull, Config->LogFileBinary);
 	LogSys.StartFileLogs();
 
 	if (signal(SIGINT, CatchSignal) == SIG_ERR)	{
@@ -99,9 +100,12 @@ int main() {
 		if(LFGuildExpireTimer.Check())
 			lfguildmanager.ExpireEntries();
 
+		database.FlushEventBatches();
+
 		EQ::EventLoop::Get().Process();
 		Sleep(5);
 	}
+	database.FlushEventBatches(true);
 	LogSys.CloseFileLogs();
 }
 
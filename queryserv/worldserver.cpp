@@ -173,6 +173,24 @@ void WorldServer::HandleMessage(uint16 opcode, const EQ::Net::Packet &p)
 		}
 		break;
 	}
+	case ServerOP_QSPlayerLogEvent: {
+		if (p.Length() < sizeof(QSPlayerLogEvent_Struct)) {
+			break;
+		}
+
+		QSPlayerLogEvent_Struct *QS = (QSPlayerLogEvent_Struct*)p.Data();
+		database.LogPlayerEvent(QS, (uint32)p.Length());
+		break;
+	}
+	case ServerOP_QSPlayerAARate: {
+		if (p.Length() < sizeof(QSPlayerAARate_Struct)) {
+			break;
+		}
+
+		QSPlayerAARate_Struct *QS = (QSPlayerAARate_Struct*)p.Data();
+		database.LogPlayerAARate(QS);
+		break;
+	}
 	case ServerOP_QSSendQuery: {
 		/* Process all packets here */
 		ServerPacket pack;
@@ -29,6 +29,7 @@
 #include "../common/string_util.h"
 #include "items.h"
 #include "npc_faction.h"
+#include "npc_types.h"
 #include "loot.h"
 #include "skill_caps.h"
 #include "spells.h"
@@ -92,6 +93,7 @@ int main(int argc, char **argv) {
 
 	/* Register Log System and Settings */
 	database.LoadLogSettings(LogSys.log_settings);
+	LogSys.SetFileLogOptions(Config->LogFileAsync, Config->LogFileQueueSize, Config->LogFileBlockWhenFull, Config->LogFileBinary);
 	LogSys.StartFileLogs();
 
 	std::string shared_mem_directory = Config->SharedMemDir;
@@ -116,6 +118,7 @@ int main(int argc, char **argv) {
 	bool load_items = false;
 	bool load_factions = false;
 	bool load_loot = false;
+	bool load_npc_types = false;
 	bool load_skill_caps = false;
 	bool load_spells = false;
 	bool load_bd = false;
@@ -150,6 +153,13 @@ int main(int argc, char **argv) {
 				}
 				break;
 	
+			case 'n':
+				if(strcasecmp("npc_types", argv[i]) == 0) {
+					load_npc_types = true;
+					load_all = false;
+				}
+				break;
+	
 			case 's':
 				if(strcasecmp("skill_caps", argv[i]) == 0) {
 					load_skill_caps = true;
@@ -209,6 +219,16 @@ int main(int argc, char **argv) {
 		}
 	}
 	
+	if(load_all || load_npc_types) {
+		LogInfo("Loading npc types");
+		try {
+			LoadNPCTypes(&database, hotfix_name);
+		} catch(std::exception &ex) {
+			LogError("{}", ex.what());
+			return 1;
+		}
+	}
+	
 	if(load_all || load_skill_caps) {
 		LogInfo("Loading skill caps");
 		try {
@@ -0,0 +1,249 @@
+/*	EQEMu: Everquest Server Emulator
+	Copyright (C) 2001-2019 EQEMu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#ifndef __EQEMU_TESTS_INVENTORY_PROFILE_H
+#define __EQEMU_TESTS_INVENTORY_PROFILE_H
+
+#include "cppunit/cpptest.h"
+#include "../common/inventory_profile.h"
+#include <string.h>
+#include <vector>
+
+class InventoryProfileTest : public Test::Suite {
+	typedef void(InventoryProfileTest::*TestFunction)(void);
+public:
+	InventoryProfileTest() {
+		TEST_ADD(InventoryProfileTest::BucketIterationOrder);
+		TEST_ADD(InventoryProfileTest::BucketOutOfRange);
+		TEST_ADD(InventoryProfileTest::PresenceProfilePutPop);
+		TEST_ADD(InventoryProfileTest::PresenceBagPutPop);
+		TEST_ADD(InventoryProfileTest::PresenceAugment);
+		TEST_ADD(InventoryProfileTest::PresenceSwap);
+	}
+
+	~InventoryProfileTest() {
+	}
+
+	private:
+	static EQ::ItemData MakeItem(uint32 id, uint8 item_class, uint32 loregroup = 0) {
+		EQ::ItemData item;
+		memset(&item, 0, sizeof(item));
+		item.ID = id;
+		item.ItemClass = item_class;
+		item.LoreGroup = loregroup;
+		item.LoreFlag = (loregroup != 0);
+		if (item_class == EQ::item::ItemClassBag)
+			item.BagSlots = 10;
+
+		return item;
+	}
+
+	void BucketIterationOrder() {
+		EQ::ItemData data = MakeItem(1001, EQ::item::ItemClassCommon);
+		EQ::ItemInstance tribute(&data, 0);
+		EQ::ItemInstance primary(&data, 0);
+		EQ::ItemInstance charm(&data, 0);
+
+		EQ::InventoryBucket bucket(EQ::invslot::EQUIPMENT_BEGIN, EQ::invslot::EQUIPMENT_END, EQ::invslot::TRIBUTE_BEGIN, EQ::invslot::TRIBUTE_END);
+		TEST_ASSERT(bucket.begin() == bucket.end());
+
+		//set out of order, read back in slot order with the tribute range after equipment
+		TEST_ASSERT(bucket.set(EQ::invslot::TRIBUTE_BEGIN + 1, &tribute));
+		TEST_ASSERT(bucket.set(EQ::invslot::slotPrimary, &primary));
+		TEST_ASSERT(bucket.set(EQ::invslot::EQUIPMENT_BEGIN, &charm));
+
+		std::vector<int16> slots;
+		for (auto iter = bucket.cbegin(); iter != bucket.cend(); ++iter)
+			slots.push_back(iter->first);
+
+		TEST_ASSERT_EQUALS(slots.size(), 3u);
+		TEST_ASSERT_EQUALS(slots[0], EQ::invslot::EQUIPMENT_BEGIN);
+		TEST_ASSERT_EQUALS(slots[1], EQ::invslot::slotPrimary);
+		TEST_ASSERT_EQUALS(slots[2], EQ::invslot::TRIBUTE_BEGIN + 1);
+
+		//emptied slots are skipped
+		bucket.erase(EQ::invslot::slotPrimary);
+		slots.clear();
+		for (auto iter = bucket.begin(); iter != bucket.end(); ++iter)
+			slots.push_back(iter->first);
+
+		TEST_ASSERT_EQUALS(slots.size(), 2u);
+		TEST_ASSERT_EQUALS(slots[0], EQ::invslot::EQUIPMENT_BEGIN);
+		TEST_ASSERT_EQUALS(slots[1], EQ::invslot::TRIBUTE_BEGIN + 1);
+
+		bucket.clear();
+		TEST_ASSERT(bucket.begin() == bucket.end());
+	}
+
+	void BucketOutOfRange() {
+		EQ::ItemData data = MakeItem(1001, EQ::item::ItemClassCommon);
+		EQ::ItemInstance inst(&data, 0);
+
+		EQ::InventoryBucket bucket(EQ::invslot::EQUIPMENT_BEGIN, EQ::invslot::EQUIPMENT_END, EQ::invslot::TRIBUTE_BEGIN, EQ::invslot::TRIBUTE_END);
+		int16 outside[] = { -1, EQ::invslot::EQUIPMENT_END + 1, EQ::invslot::TRIBUTE_BEGIN - 1, EQ::invslot::TRIBUTE_END + 1 };
+
+		for (auto slot_id : outside) {
+			TEST_ASSERT(!bucket.set(slot_id, &inst));
+			TEST_ASSERT(bucket[slot_id] == nullptr);
+			TEST_ASSERT(bucket.find(slot_id) == bucket.cend());
+		}
+
+		TEST_ASSERT(bucket.begin() == bucket.end());
+
+		TEST_ASSERT(bucket.set(EQ::invslot::TRIBUTE_END, &inst));
+		TEST_ASSERT(bucket[EQ::invslot::TRIBUTE_END] == &inst);
+		TEST_ASSERT(bucket.find(EQ::invslot::TRIBUTE_END) != bucket.cend());
+		TEST_ASSERT(bucket.find(EQ::invslot::TRIBUTE_END)->second == &inst);
+		TEST_ASSERT(bucket.find(EQ::invslot::TRIBUTE_END - 1) == bucket.cend());
+	}
+
+	void PresenceProfilePutPop() {
+		EQ::InventoryProfile profile;
+		profile.SetInventoryVersion(EQ::versions::MobVersion::RoF2);
+
+		EQ::ItemData data = MakeItem(2001, EQ::item::ItemClassCommon, 77);
+		EQ::ItemInstance inst(&data, 0);
+
+		TEST_ASSERT_EQUALS(profile.HasItem(2001), INVALID_INDEX);
+		TEST_ASSERT_EQUALS(profile.HasItemByLoreGroup(77), INVALID_INDEX);
+
+		TEST_ASSERT_EQUALS(profile.PutItem(EQ::invslot::GENERAL_BEGIN, inst), EQ::invslot::GENERAL_BEGIN);
+		TEST_ASSERT_EQUALS(profile.HasItem(2001), EQ::invslot::GENERAL_BEGIN);
+		TEST_ASSERT_EQUALS(profile.HasItem(2001, 1, invWhereBank), INVALID_INDEX);
+		TEST_ASSERT_EQUALS(profile.GetItemPresence(2001), invWherePersonal);
+		TEST_ASSERT_EQUALS(profile.HasItemByLoreGroup(77), EQ::invslot::GENERAL_BEGIN);
+
+		//two copies, one popped, the other still counts
+		TEST_ASSERT_EQUALS(profile.PushCursor(inst), EQ::invslot::slotCursor);
+		TEST_ASSERT_EQUALS(profile.GetItemPresence(2001), invWherePersonal | invWhereCursor);
+		TEST_ASSERT(profile.DeleteItem(EQ::invslot::GENERAL_BEGIN));
+		TEST_ASSERT_EQUALS(profile.HasItem(2001), EQ::invslot::slotCursor);
+		TEST_ASSERT_EQUALS(profile.GetItemPresence(2001), invWhereCursor);
+
+		TEST_ASSERT(profile.DeleteItem(EQ::invslot::slotCursor));
+		TEST_ASSERT_EQUALS(profile.HasItem(2001), INVALID_INDEX);
+		TEST_ASSERT_EQUALS(profile.HasItemByLoreGroup(77), INVALID_INDEX);
+		TEST_ASSERT_EQUALS(profile.GetItemPresence(2001), 0);
+		TEST_ASSERT_EQUALS(profile.GetLoreGroupPresence(77), 0);
+	}
+
+	void PresenceBagPutPop() {
+		EQ::InventoryProfile profile;
+		profile.SetInventoryVersion(EQ::versions::MobVersion::RoF2);
+
+		EQ::ItemData bag_data = MakeItem(3001, EQ::item::ItemClassBag);
+		EQ::ItemData gem_data = MakeItem(3002, EQ::item::ItemClassCommon, 78);
+		EQ::ItemInstance bag(&bag_data, 0);
+		EQ::ItemInstance gem(&gem_data, 0);
+
+		int16 bag_slot = EQ::invslot::GENERAL_BEGIN + 1;
+		int16 gem_slot = EQ::InventoryProfile::CalcSlotId(bag_slot, 0);
+		profile.PutItem(bag_slot, bag);
+		TEST_ASSERT_EQUALS(profile.HasItem(3002), INVALID_INDEX);
+
+		//put and pop through the profile
+		TEST_ASSERT_EQUALS(profile.PutItem(gem_slot, gem), gem_slot);
+		TEST_ASSERT_EQUALS(profile.HasItem(3002), gem_slot);
+		TEST_ASSERT_EQUALS(profile.HasItemByLoreGroup(78), gem_slot);
+		TEST_ASSERT_EQUALS(profile.GetItemPresence(3002), invWherePersonal);
+		TEST_ASSERT(profile.DeleteItem(gem_slot));
+		TEST_ASSERT_EQUALS(profile.HasItem(3002), INVALID_INDEX);
+		TEST_ASSERT_EQUALS(profile.GetItemPresence(3002), 0);
+
+		//put and pop straight on the bag
+		profile.GetItem(bag_slot)->PutItem(0, gem);
+		TEST_ASSERT_EQUALS(profile.HasItem(3002), gem_slot);
+
+		EQ::ItemInstance* popped = profile.GetItem(bag_slot)->PopItem(0);
+		TEST_ASSERT(popped != nullptr);
+		TEST_ASSERT_EQUALS(profile.HasItem(3002), INVALID_INDEX);
+		TEST_ASSERT_EQUALS(profile.HasItemByLoreGroup(78), INVALID_INDEX);
+		TEST_ASSERT_EQUALS(profile.GetItemPresence(3002), 0);
+		TEST_ASSERT_EQUALS(profile.GetLoreGroupPresence(78), 0);
+
+		//changing an item that already left the profile does not bring it back
+		popped->PutAugment(0, gem);
+		TEST_ASSERT_EQUALS(profile.HasItem(3002), INVALID_INDEX);
+		delete popped;
+
+		//the whole bag moving takes its contents along
+		profile.GetItem(bag_slot)->PutItem(3, gem);
+		TEST_ASSERT(profile.DeleteItem(bag_slot));
+		TEST_ASSERT_EQUALS(profile.HasItem(3002), INVALID_INDEX);
+		TEST_ASSERT_EQUALS(profile.HasItem(3001), INVALID_INDEX);
+		TEST_ASSERT_EQUALS(profile.GetItemPresence(3002), 0);
+		TEST_ASSERT_EQUALS(profile.GetItemPresence(3001), 0);
+	}
+
+	void PresenceAugment() {
+		EQ::InventoryProfile profile;
+		profile.SetInventoryVersion(EQ::versions::MobVersion::RoF2);
+
+		EQ::ItemData weapon_data = MakeItem(4001, EQ::item::ItemClassCommon);
+		EQ::ItemData aug_data = MakeItem(4002, EQ::item::ItemClassCommon, 79);
+		weapon_data.Slots = (1 << EQ::invslot::slotPrimary);
+		EQ::ItemInstance weapon(&weapon_data, 0);
+		EQ::ItemInstance aug(&aug_data, 0);
+
+		profile.PutItem(EQ::invslot::slotPrimary, weapon);
+		TEST_ASSERT_EQUALS(profile.HasItem(4002), INVALID_INDEX);
+
+		profile.GetItem(EQ::invslot::slotPrimary)->PutAugment(EQ::invaug::SOCKET_BEGIN, aug);
+		TEST_ASSERT_EQUALS(profile.HasItem(4002), EQ::invslot::SLOT_AUGMENT_GENERIC_RETURN);
+		TEST_ASSERT_EQUALS(profile.HasItemByLoreGroup(79), EQ::invslot::SLOT_AUGMENT_GENERIC_RETURN);
+
+		TEST_ASSERT_EQUALS(profile.GetItemPresence(4002), invWhereWorn);
+
+		profile.GetItem(EQ::invslot::slotPrimary)->DeleteAugment(EQ::invaug::SOCKET_BEGIN);
+		TEST_ASSERT_EQUALS(profile.HasItem(4002), INVALID_INDEX);
+		TEST_ASSERT_EQUALS(profile.HasItemByLoreGroup(79), INVALID_INDEX);
+		TEST_ASSERT_EQUALS(profile.GetItemPresence(4002), 0);
+		TEST_ASSERT_EQUALS(profile.GetLoreGroupPresence(79), 0);
+	}
+
+	void PresenceSwap() {
+		EQ::InventoryProfile profile;
+		profile.SetInventoryVersion(EQ::versions::MobVersion::RoF2);
+
+		EQ::ItemData first_data = MakeItem(5001, EQ::item::ItemClassCommon);
+		EQ::ItemData second_data = MakeItem(5002, EQ::item::ItemClassCommon);
+		EQ::ItemInstance first(&first_data, 0);
+		EQ::ItemInstance second(&second_data, 0);
+
+		EQ::InventoryProfile::SwapItemFailState fail_state;
+		profile.PutItem(EQ::invslot::GENERAL_BEGIN, first);
+
+		//into an empty slot
+		TEST_ASSERT(profile.SwapItem(EQ::invslot::GENERAL_BEGIN, EQ::invslot::BANK_BEGIN, fail_state));
+		TEST_ASSERT_EQUALS(profile.HasItem(5001, 1, invWherePersonal), INVALID_INDEX);
+		TEST_ASSERT_EQUALS(profile.HasItem(5001, 1, invWhereBank), EQ::invslot::BANK_BEGIN);
+		TEST_ASSERT_EQUALS(profile.GetItemPresence(5001), invWhereBank);
+
+		//with an item on both sides
+		profile.PutItem(EQ::invslot::GENERAL_BEGIN, second);
+		TEST_ASSERT(profile.SwapItem(EQ::invslot::GENERAL_BEGIN, EQ::invslot::BANK_BEGIN, fail_state));
+		TEST_ASSERT_EQUALS(profile.HasItem(5001, 1, invWherePersonal), EQ::invslot::GENERAL_BEGIN);
+		TEST_ASSERT_EQUALS(profile.HasItem(5001, 1, invWhereBank), INVALID_INDEX);
+		TEST_ASSERT_EQUALS(profile.HasItem(5002, 1, invWherePersonal), INVALID_INDEX);
+		TEST_ASSERT_EQUALS(profile.HasItem(5002, 1, invWhereBank), EQ::invslot::BANK_BEGIN);
+		TEST_ASSERT_EQUALS(profile.GetItemPresence(5001), invWherePersonal);
+		TEST_ASSERT_EQUALS(profile.GetItemPresence(5002), invWhereBank);
+	}
+};
+
+#endif
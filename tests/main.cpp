@@ -29,9 +29,14 @@
 #include "string_util_test.h"
 #include "data_verification_test.h"
 #include "skills_util_test.h"
+#include "pathfinder_cache_test.h"
+#include "inventory_profile_test.h"
+#include "spdat_hot_test.h"
 #include "../common/eqemu_config.h"
+#include "../common/eqemu_logsys.h"
 
 const EQEmuConfig *Config;
+EQEmuLogSys LogSys;
 
 int main() {
 	auto ConfigLoadResult = EQEmuConfig::LoadConfig();
@@ -49,6 +54,9 @@ int main() {
 		tests.add(new StringUtilTest());
 		tests.add(new DataVerificationTest());
 		tests.add(new SkillsUtilsTest());
+		tests.add(new PathfinderCacheTest());
+		tests.add(new InventoryProfileTest());
+		tests.add(new SpellHotViewTest());
 		tests.run(*output, true);
 	} catch(...) {
 		return -1;
@@ -0,0 +1,113 @@
+/*	EQEMu: Everquest Server Emulator
+	Copyright (C) 2001-2019 EQEMu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#ifndef __EQEMU_TESTS_PATHFINDER_CACHE_H
+#define __EQEMU_TESTS_PATHFINDER_CACHE_H
+
+#include "cppunit/cpptest.h"
+#include "../zone/pathfinder_cache.h"
+#include <list>
+
+class PathfinderCacheTest : public Test::Suite {
+	typedef void(PathfinderCacheTest::*TestFunction)(void);
+
+	//same shape as IPathfinder::IPathNode, the zone headers can't be pulled in here
+	struct Node {
+		Node(const glm::vec3 &p) : pos(p), teleport(false) { }
+		Node(bool tp) : teleport(tp) { }
+
+		glm::vec3 pos;
+		bool teleport;
+	};
+
+	typedef std::list<Node> Route;
+
+public:
+	PathfinderCacheTest() {
+		TEST_ADD(PathfinderCacheTest::SingleNodeRoute);
+		TEST_ADD(PathfinderCacheTest::MultiNodeRoute);
+		TEST_ADD(PathfinderCacheTest::PartialRoute);
+		TEST_ADD(PathfinderCacheTest::TeleportNodes);
+	}
+
+	~PathfinderCacheTest() {
+	}
+
+	private:
+	void SingleNodeRoute() {
+		//the no poly fallback is just the destination, a cache hit must not turn it into the start
+		Route route;
+		route.push_back(glm::vec3(100.0f, 200.0f, 5.0f));
+
+		FixupCachedRoute(route, glm::vec3(1.0f, 2.0f, 3.0f), glm::vec3(101.0f, 202.0f, 5.0f), false);
+
+		TEST_ASSERT_EQUALS(route.size(), 1u);
+		TEST_ASSERT_EQUALS(route.front().pos.x, 101.0f);
+		TEST_ASSERT_EQUALS(route.front().pos.y, 202.0f);
+		TEST_ASSERT_EQUALS(route.front().pos.z, 5.0f);
+	}
+
+	void MultiNodeRoute() {
+		Route route;
+		route.push_back(glm::vec3(0.5f, 0.5f, 1.0f));
+		route.push_back(glm::vec3(50.0f, 50.0f, 1.0f));
+		route.push_back(glm::vec3(100.5f, 100.5f, 1.0f));
+
+		FixupCachedRoute(route, glm::vec3(1.0f, 2.0f, 3.0f), glm::vec3(101.0f, 102.0f, 3.0f), false);
+
+		auto iter = route.begin();
+		TEST_ASSERT_EQUALS(iter->pos.x, 1.0f);
+		TEST_ASSERT_EQUALS(iter->pos.y, 2.0f);
+		TEST_ASSERT_EQUALS(iter->pos.z, 1.0f);
+		++iter;
+		TEST_ASSERT_EQUALS(iter->pos.x, 50.0f);
+		TEST_ASSERT_EQUALS(iter->pos.y, 50.0f);
+		++iter;
+		TEST_ASSERT_EQUALS(iter->pos.x, 101.0f);
+		TEST_ASSERT_EQUALS(iter->pos.y, 102.0f);
+	}
+
+	void PartialRoute() {
+		//a partial route stops short of the destination, its last node stays where the mesh ended
+		Route route;
+		route.push_back(glm::vec3(0.5f, 0.5f, 1.0f));
+		route.push_back(glm::vec3(40.0f, 40.0f, 1.0f));
+
+		FixupCachedRoute(route, glm::vec3(1.0f, 2.0f, 3.0f), glm::vec3(101.0f, 102.0f, 3.0f), true);
+
+		TEST_ASSERT_EQUALS(route.front().pos.x, 1.0f);
+		TEST_ASSERT_EQUALS(route.front().pos.y, 2.0f);
+		TEST_ASSERT_EQUALS(route.back().pos.x, 40.0f);
+		TEST_ASSERT_EQUALS(route.back().pos.y, 40.0f);
+	}
+
+	void TeleportNodes() {
+		Route route;
+		route.push_back(true);
+		route.push_back(glm::vec3(50.0f, 50.0f, 1.0f));
+		route.push_back(true);
+
+		FixupCachedRoute(route, glm::vec3(1.0f, 2.0f, 3.0f), glm::vec3(101.0f, 102.0f, 3.0f), false);
+
+		TEST_ASSERT(route.front().teleport);
+		TEST_ASSERT(route.back().teleport);
+		TEST_ASSERT_EQUALS((++route.begin())->pos.x, 50.0f);
+	}
+};
+
+#endif
@@ -0,0 +1,148 @@
+/*	EQEMu: Everquest Server Emulator
+	Copyright (C) 2001-2020 EQEMu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#ifndef __EQEMU_TESTS_SPDAT_HOT_H
+#define __EQEMU_TESTS_SPDAT_HOT_H
+
+#include "cppunit/cpptest.h"
+#include "../common/classes.h"
+#include "../common/spdat.h"
+#include <string.h>
+#include <vector>
+
+class SpellHotViewTest : public Test::Suite {
+	typedef void(SpellHotViewTest::*TestFunction)(void);
+public:
+	SpellHotViewTest() {
+		TEST_ADD(SpellHotViewTest::Flags);
+		TEST_ADD(SpellHotViewTest::Fields);
+	}
+
+	~SpellHotViewTest() {
+	}
+
+	private:
+	enum {
+		SpellGroupBuff = 2,
+		SpellNuke,
+		SpellSelfCancelMagic,
+		SpellTargetCancelMagic,
+		SpellCalm,
+		SpellBardSong,
+		SpellBardDiscipline,
+		SpellNoActor,
+		SpellCount
+	};
+
+	static void MakeSpell(SPDat_Spell_Struct &spell, int8 good_effect, SpellTargetType target_type, int effect = SE_Blank) {
+		memset(&spell, 0, sizeof(spell));
+		strcpy(spell.player_1, "PLAYER_1");
+		spell.goodEffect = good_effect;
+		spell.targettype = target_type;
+		spell.resisttype = RESIST_MAGIC;
+		for (int j = 0; j < EFFECT_COUNT; ++j)
+			spell.effectid[j] = SE_Blank;
+		spell.effectid[0] = effect;
+		for (int j = 0; j < PLAYER_CLASS_COUNT; ++j)
+			spell.classes[j] = 255;
+		BuildSpellEffectMask(spell);
+	}
+
+	static std::vector<SPDat_Spell_Struct> MakeSpells() {
+		std::vector<SPDat_Spell_Struct> sp(SpellCount);
+		for (int i = 0; i < SpellCount; ++i)
+			MakeSpell(sp[i], 1, ST_Group);
+
+		MakeSpell(sp[SpellNuke], 0, ST_Target, SE_CurrentHP);
+		MakeSpell(sp[SpellSelfCancelMagic], 1, ST_Self, SE_CancelMagic);
+		MakeSpell(sp[SpellTargetCancelMagic], 1, ST_Target, SE_CancelMagic);
+		MakeSpell(sp[SpellCalm], 1, ST_Target, SE_ChangeFrenzyRad);
+		sp[SpellCalm].SpellAffectIndex = SAI_Calm;
+		sp[SpellBardSong].classes[BARD - 1] = 10;
+		sp[SpellBardDiscipline].classes[BARD - 1] = 10;
+		sp[SpellBardDiscipline].IsDisciplineBuff = true;
+		sp[SpellNoActor].player_1[0] = '\0';
+		sp[SpellNoActor].classes[BARD - 1] = 10;
+
+		return sp;
+	}
+
+	static SPDat_Spell_Hot BuildView(const std::vector<SPDat_Spell_Struct> &sp, std::vector<uint32> &buffer) {
+		// uint32 backing so the view starts 4 byte aligned like it does in the segment
+		buffer.assign((GetSpellHotViewSize(static_cast<int>(sp.size())) + 3) / 4, 0xFFFFFFFF);
+		BuildSpellHotView(&sp[0], static_cast<int>(sp.size()), &buffer[0]);
+
+		SPDat_Spell_Hot view;
+		MapSpellHotView(&buffer[0], static_cast<int>(sp.size()), &view);
+		return view;
+	}
+
+	void Flags() {
+		std::vector<SPDat_Spell_Struct> sp = MakeSpells();
+		std::vector<uint32> buffer;
+		SPDat_Spell_Hot view = BuildView(sp, buffer);
+
+		TEST_ASSERT_EQUALS(view.records, SpellCount);
+
+		//ids 0 and 1 and records without an actor tag are never valid
+		TEST_ASSERT_EQUALS(view.flags[0], 0);
+		TEST_ASSERT_EQUALS(view.flags[1], 0);
+		TEST_ASSERT_EQUALS(view.flags[SpellNoActor], 0);
+
+		for (int i = SpellGroupBuff; i < SpellNoActor; ++i) {
+			TEST_ASSERT((view.flags[i] & SPELL_HOT_VALID) != 0);
+			TEST_ASSERT_EQUALS((view.flags[i] & SPELL_HOT_BENEFICIAL) != 0, IsBeneficialSpellRecord(sp[i]));
+			TEST_ASSERT_EQUALS((view.flags[i] & SPELL_HOT_BARD_SONG) != 0, sp[i].classes[BARD - 1] < 255 && !sp[i].IsDisciplineBuff);
+		}
+
+		TEST_ASSERT((view.flags[SpellGroupBuff] & SPELL_HOT_BENEFICIAL) != 0);
+		TEST_ASSERT((view.flags[SpellNuke] & SPELL_HOT_BENEFICIAL) == 0);
+		TEST_ASSERT((view.flags[SpellSelfCancelMagic] & SPELL_HOT_BENEFICIAL) != 0);
+		TEST_ASSERT((view.flags[SpellTargetCancelMagic] & SPELL_HOT_BENEFICIAL) == 0);
+		TEST_ASSERT((view.flags[SpellCalm] & SPELL_HOT_BENEFICIAL) == 0);
+		TEST_ASSERT((view.flags[SpellBardSong] & SPELL_HOT_BARD_SONG) != 0);
+		TEST_ASSERT((view.flags[SpellBardDiscipline] & SPELL_HOT_BARD_SONG) == 0);
+		TEST_ASSERT((view.flags[SpellGroupBuff] & SPELL_HOT_BARD_SONG) == 0);
+	}
+
+	void Fields() {
+		std::vector<SPDat_Spell_Struct> sp = MakeSpells();
+		sp[SpellNuke].base[0] = -100;
+		sp[SpellNuke].base2[0] = 7;
+		sp[SpellNuke].max[0] = -250;
+		sp[SpellNuke].resisttype = RESIST_FIRE;
+
+		std::vector<uint32> buffer;
+		SPDat_Spell_Hot view = BuildView(sp, buffer);
+
+		for (int i = 0; i < SpellCount; ++i) {
+			TEST_ASSERT_EQUALS(view.targettype[i], static_cast<uint8>(sp[i].targettype));
+			TEST_ASSERT_EQUALS(view.resisttype[i], static_cast<int16>(sp[i].resisttype));
+			TEST_ASSERT(memcmp(view.effectid[i], sp[i].effectid, sizeof(sp[i].effectid)) == 0);
+			TEST_ASSERT(memcmp(view.effect_mask[i], sp[i].effect_mask, sizeof(sp[i].effect_mask)) == 0);
+		}
+
+		TEST_ASSERT_EQUALS(view.base[SpellNuke][0], -100);
+		TEST_ASSERT_EQUALS(view.base2[SpellNuke][0], 7);
+		TEST_ASSERT_EQUALS(view.max[SpellNuke][0], -250);
+		TEST_ASSERT_EQUALS(view.resisttype[SpellNuke], RESIST_FIRE);
+		TEST_ASSERT((view.effect_mask[SpellTargetCancelMagic][SE_CancelMagic >> 5] & (1u << (SE_CancelMagic & 31))) != 0);
+	}
+};
+
+#endif
@@ -59,12 +59,7 @@ ChatChannel::ChatChannel(std::string inName, std::string inOwner, std::string in
 
 ChatChannel::~ChatChannel() {
 
-	LinkedListIterator<Client*> iterator(ClientsInChannel);
-
-	iterator.Reset();
-
-	while(iterator.MoreElements())
-		iterator.RemoveCurrent(false);
+	ClientsInChannel.clear();
 }
 
 ChatChannel* ChatChannelList::CreateChannel(std::string Name, std::string Owner, std::string Password, bool Permanent, int MinimumStatus) {
@@ -73,28 +68,19 @@ ChatChannel* ChatChannelList::CreateChannel(std::string Name, std::string Owner,
 
 	ChatChannels.Insert(NewChannel);
 
+	ChannelsByName[NewChannel->GetName()] = NewChannel;
+
 	return NewChannel;
 }
 
 ChatChannel* ChatChannelList::FindChannel(std::string Name) {
 
-	std::string NormalisedName = CapitaliseName(Name);
-
-	LinkedListIterator<ChatChannel*> iterator(ChatChannels);
-
-	iterator.Reset();
-
-	while(iterator.MoreElements()) {
-
-		ChatChannel *CurrentChannel = iterator.GetData();
-
-		if(CurrentChannel && (CurrentChannel->Name == NormalisedName))
-			return iterator.GetData();
+	auto it = ChannelsByName.find(CapitaliseName(Name));
 
-		iterator.Advance();
-	}
+	if(it == ChannelsByName.end())
+		return nullptr;
 
-	return nullptr;
+	return it->second;
 }
 
 void ChatChannelList::SendAllChannels(Client *c) {
@@ -161,6 +147,11 @@ void ChatChannelList::RemoveChannel(ChatChannel *Channel) {
 
 	LogDebug("RemoveChannel ([{}])", Channel->GetName().c_str());
 
+	auto it = ChannelsByName.find(Channel->GetName());
+
+	if(it != ChannelsByName.end() && it->second == Channel)
+		ChannelsByName.erase(it);
+
 	LinkedListIterator<ChatChannel*> iterator(ChatChannels);
 
 	iterator.Reset();
@@ -182,6 +173,8 @@ void ChatChannelList::RemoveAllChannels() {
 
 	LogDebug("RemoveAllChannels");
 
+	ChannelsByName.clear();
+
 	LinkedListIterator<ChatChannel*> iterator(ChatChannels);
 
 	iterator.Reset();
@@ -194,18 +187,10 @@ int ChatChannel::MemberCount(int Status) {
 
 	int Count = 0;
 
-	LinkedListIterator<Client*> iterator(ClientsInChannel);
-
-	iterator.Reset();
-
-	while(iterator.MoreElements()) {
+	for(auto ChannelClient : ClientsInChannel) {
 
-		Client *ChannelClient = iterator.GetData();
-
-		if(ChannelClient && (!ChannelClient->GetHideMe() || (ChannelClient->GetAccountStatus() < Status)))
+		if(!ChannelClient->GetHideMe() || (ChannelClient->GetAccountStatus() < Status))
 			Count++;
-
-		iterator.Advance();
 	}
 
 	return Count;
@@ -249,22 +234,14 @@ void ChatChannel::AddClient(Client *c) {
 
 	LogDebug("Adding [{}] to channel [{}]", c->GetName().c_str(), Name.c_str());
 
-	LinkedListIterator<Client*> iterator(ClientsInChannel);
-
-	iterator.Reset();
-
-	while(iterator.MoreElements()) {
-
-		Client *CurrentClient = iterator.GetData();
+	for(auto CurrentClient : ClientsInChannel) {
 
-		if(CurrentClient && CurrentClient->IsAnnounceOn())
+		if(CurrentClient->IsAnnounceOn())
 			if(!HideMe || (CurrentClient->GetAccountStatus() > AccountStatus))
 				CurrentClient->AnnounceJoin(this, c);
-
-		iterator.Advance();
 	}
 
-	ClientsInChannel.Insert(c);
+	ClientsInChannel.insert(c);
 
 }
 
@@ -278,30 +255,15 @@ bool ChatChannel::RemoveClient(Client *c) {
 
 	int AccountStatus = c->GetAccountStatus();
 
-	int PlayersInChannel = 0;
-
-	LinkedListIterator<Client*> iterator(ClientsInChannel);
-
-	iterator.Reset();
-
-	while(iterator.MoreElements()) {
-
-		Client *CurrentClient = iterator.GetData();
-
-		if(CurrentClient == c) {
-			iterator.RemoveCurrent(false);
-		}
-		else if(CurrentClient) {
-
-			PlayersInChannel++;
+	ClientsInChannel.erase(c);
 
-			if(CurrentClient->IsAnnounceOn())
-				if(!HideMe || (CurrentClient->GetAccountStatus() > AccountStatus))
-					CurrentClient->AnnounceLeave(this, c);
+	int PlayersInChannel = ClientsInChannel.size();
 
-			iterator.Advance();
-		}
+	for(auto CurrentClient : ClientsInChannel) {
 
+		if(CurrentClient->IsAnnounceOn())
+			if(!HideMe || (CurrentClient->GetAccountStatus() > AccountStatus))
+				CurrentClient->AnnounceLeave(this, c);
 	}
 
 	if((PlayersInChannel == 0) && !Permanent) {
@@ -350,20 +312,12 @@ void ChatChannel::SendChannelMembers(Client *c) {
 
 	int MembersInLine = 0;
 
-	LinkedListIterator<Client*> iterator(ClientsInChannel);
-
-	iterator.Reset();
-
-	while(iterator.MoreElements()) {
-
-		Client *ChannelClient = iterator.GetData();
+	for(auto ChannelClient : ClientsInChannel) {
 
 		// Don't list hidden characters with status higher or equal than the character requesting the list.
 		//
-		if(!ChannelClient || (ChannelClient->GetHideMe() && (ChannelClient->GetAccountStatus() >= AccountStatus))) {
-			iterator.Advance();
+		if(ChannelClient->GetHideMe() && (ChannelClient->GetAccountStatus() >= AccountStatus))
 			continue;
-		}
 
 		if(MembersInLine > 0)
 			Message += ", ";
@@ -380,8 +334,6 @@ void ChatChannel::SendChannelMembers(Client *c) {
 
 			Message.clear();
 		}
-
-		iterator.Advance();
 	}
 
 	if(MembersInLine > 0)
@@ -393,47 +345,45 @@ void ChatChannel::SendMessageToChannel(std::string Message, Client* Sender) {
 
 	if(!Sender) return;
 
+	// say links are translated and the packet built once per client version, then shared by every member on it
 	std::string cv_messages[EQ::versions::ClientVersionCount];
+	std::shared_ptr<EQApplicationPacket> cv_packets[EQ::versions::ClientVersionCount][2];
 
 	ChatMessagesSent++;
 
-	LinkedListIterator<Client*> iterator(ClientsInChannel);
-
-	iterator.Reset();
-
-	while(iterator.MoreElements()) {
+	for(auto ChannelClient : ClientsInChannel) {
 
-		Client *ChannelClient = iterator.GetData();
+		LogDebug("Sending message to [{}] from [{}]",
+			ChannelClient->GetName().c_str(), Sender->GetName().c_str());
 
-		if(ChannelClient)
-		{
-			LogDebug("Sending message to [{}] from [{}]",
-				ChannelClient->GetName().c_str(), Sender->GetName().c_str());
+		uint32 cv = static_cast<uint32>(ChannelClient->GetClientVersion());
+		int uf = ChannelClient->IsUnderfootOrLater() ? 1 : 0;
 
-			if (cv_messages[static_cast<uint32>(ChannelClient->GetClientVersion())].length() == 0) {
+		if (!cv_packets[cv][uf]) {
+			if (cv_messages[cv].length() == 0) {
 				switch (ChannelClient->GetClientVersion()) {
 				case EQ::versions::ClientVersion::Titanium:
-					ServerToClient45SayLink(cv_messages[static_cast<uint32>(ChannelClient->GetClientVersion())], Message);
+					ServerToClient45SayLink(cv_messages[cv], Message);
 					break;
 				case EQ::versions::ClientVersion::SoF:
 				case EQ::versions::ClientVersion::SoD:
 				case EQ::versions::ClientVersion::UF:
-					ServerToClient50SayLink(cv_messages[static_cast<uint32>(ChannelClient->GetClientVersion())], Message);
+					ServerToClient50SayLink(cv_messages[cv], Message);
 					break;
 				case EQ::versions::ClientVersion::RoF:
-					ServerToClient55SayLink(cv_messages[static_cast<uint32>(ChannelClient->GetClientVersion())], Message);
+					ServerToClient55SayLink(cv_messages[cv], Message);
 					break;
 				case EQ::versions::ClientVersion::RoF2:
 				default:
-					cv_messages[static_cast<uint32>(ChannelClient->GetClientVersion())] = Message;
+					cv_messages[cv] = Message;
 					break;
 				}
 			}
 
-			ChannelClient->SendChannelMessage(Name, cv_messages[static_cast<uint32>(ChannelClient->GetClientVersion())], Sender);
+			cv_packets[cv][uf].reset(Client::MakeChannelMessagePacket(Name, cv_messages[cv], Sender, uf == 1));
 		}
 
-		iterator.Advance();
+		ChannelClient->QueueDelivery(cv_packets[cv][uf]);
 	}
 }
 
@@ -441,23 +391,12 @@ void ChatChannel::SetModerated(bool inModerated) {
 
 	Moderated = inModerated;
 
-	LinkedListIterator<Client*> iterator(ClientsInChannel);
-
-	iterator.Reset();
-
-	while(iterator.MoreElements()) {
-
-		Client *ChannelClient = iterator.GetData();
+	for(auto ChannelClient : ClientsInChannel) {
 
-		if(ChannelClient) {
-
-			if(Moderated)
-				ChannelClient->GeneralChannelMessage("Channel " + Name + " is now moderated.");
-			else
-				ChannelClient->GeneralChannelMessage("Channel " + Name + " is no longer moderated.");
-		}
-
-		iterator.Advance();
+		if(Moderated)
+			ChannelClient->GeneralChannelMessage("Channel " + Name + " is now moderated.");
+		else
+			ChannelClient->GeneralChannelMessage("Channel " + Name + " is no longer moderated.");
 	}
 
 }
@@ -465,19 +404,7 @@ bool ChatChannel::IsClientInChannel(Client *c) {
 
 	if(!c) return false;
 
-	LinkedListIterator<Client*> iterator(ClientsInChannel);
-
-	iterator.Reset();
-
-	while(iterator.MoreElements()) {
-
-		if(iterator.GetData() == c)
-			return true;
-
-		iterator.Advance();
-	}
-
-	return false;
+	return ClientsInChannel.count(c) > 0;
 }
 
 ChatChannel *ChatChannelList::AddClientToChannel(std::string ChannelName, Client *c) {
@@ -599,9 +526,7 @@ void ChatChannelList::Process() {
 
 void ChatChannel::AddInvitee(const std::string &Invitee)
 {
-	if (!IsInvitee(Invitee)) {
-		Invitees.push_back(Invitee);
-
+	if (Invitees.insert(Invitee).second) {
 		LogDebug("Added [{}] as invitee to channel [{}]", Invitee.c_str(), Name.c_str());
 	}
 
@@ -609,24 +534,19 @@ void ChatChannel::AddInvitee(const std::string &Invitee)
 
 void ChatChannel::RemoveInvitee(std::string Invitee)
 {
-	auto it = std::find(std::begin(Invitees), std::end(Invitees), Invitee);
-
-	if(it != std::end(Invitees)) {
-		Invitees.erase(it);
+	if (Invitees.erase(Invitee) > 0) {
 		LogDebug("Removed [{}] as invitee to channel [{}]", Invitee.c_str(), Name.c_str());
 	}
 }
 
 bool ChatChannel::IsInvitee(std::string Invitee)
 {
-	return std::find(std::begin(Invitees), std::end(Invitees), Invitee) != std::end(Invitees);
+	return Invitees.count(Invitee) > 0;
 }
 
 void ChatChannel::AddModerator(const std::string &Moderator)
 {
-	if (!IsModerator(Moderator)) {
-		Moderators.push_back(Moderator);
-
+	if (Moderators.insert(Moderator).second) {
 		LogInfo("Added [{}] as moderator to channel [{}]", Moderator.c_str(), Name.c_str());
 	}
 
@@ -634,42 +554,33 @@ void ChatChannel::AddModerator(const std::string &Moderator)
 
 void ChatChannel::RemoveModerator(const std::string &Moderator)
 {
-	auto it = std::find(std::begin(Moderators), std::end(Moderators), Moderator);
-
-	if (it != std::end(Moderators)) {
-		Moderators.erase(it);
+	if (Moderators.erase(Moderator) > 0) {
 		LogInfo("Removed [{}] as moderator to channel [{}]", Moderator.c_str(), Name.c_str());
 	}
 }
 
 bool ChatChannel::IsModerator(std::string Moderator)
 {
-	return std::find(std::begin(Moderators), std::end(Moderators), Moderator) != std::end(Moderators);
+	return Moderators.count(Moderator) > 0;
 }
 
 void ChatChannel::AddVoice(const std::string &inVoiced)
 {
-	if (!HasVoice(inVoiced)) {
-		Voiced.push_back(inVoiced);
-
+	if (Voiced.insert(inVoiced).second) {
 		LogInfo("Added [{}] as voiced to channel [{}]", inVoiced.c_str(), Name.c_str());
 	}
 }
 
 void ChatChannel::RemoveVoice(const std::string &inVoiced)
 {
-	auto it = std::find(std::begin(Voiced), std::end(Voiced), inVoiced);
-
-	if (it != std::end(Voiced)) {
-		Voiced.erase(it);
-
+	if (Voiced.erase(inVoiced) > 0) {
 		LogInfo("Removed [{}] as voiced to channel [{}]", inVoiced.c_str(), Name.c_str());
 	}
 }
 
 bool ChatChannel::HasVoice(std::string inVoiced)
 {
-	return std::find(std::begin(Voiced), std::end(Voiced), inVoiced) != std::end(Voiced);
+	return Voiced.count(inVoiced) > 0;
 }
 
 std::string CapitaliseName(std::string inString) {
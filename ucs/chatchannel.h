@@ -6,6 +6,8 @@
 #include "../common/timer.h"
 #include <string>
 #include <vector>
+#include <unordered_set>
+#include <unordered_map>
 
 class Client;
 
@@ -58,11 +60,11 @@ private:
 
 	Timer DeleteTimer;
 
-	LinkedList<Client*> ClientsInChannel;
+	std::unordered_set<Client*> ClientsInChannel;
 
-	std::vector<std::string> Moderators;
-	std::vector<std::string> Invitees;
-	std::vector<std::string> Voiced;
+	std::unordered_set<std::string> Moderators;
+	std::unordered_set<std::string> Invitees;
+	std::unordered_set<std::string> Voiced;
 
 };
 
@@ -82,6 +84,7 @@ public:
 private:
 
 	LinkedList<ChatChannel*> ChatChannels;
+	std::unordered_map<std::string, ChatChannel*> ChannelsByName;
 
 };
 
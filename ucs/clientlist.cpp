@@ -526,6 +526,10 @@ Client::Client(std::shared_ptr<EQStreamInterface> eqs) {
 	ClientVersion_ = EQ::versions::ClientVersion::Unknown;
 
 	UnderfootOrLater = false;
+
+	DeliveryBudget = RuleI(Chat, DeliveryBurst);
+	LastDeliveryRefill = Timer::GetCurrentTime();
+	DroppedDeliveries = 0;
 }
 
 Client::~Client() {
@@ -547,6 +551,50 @@ Client::~Client() {
 	}
 }
 
+void Client::QueueDelivery(const std::shared_ptr<EQApplicationPacket> &p) {
+
+	if (!p)
+		return;
+
+	size_t MaxQueued = static_cast<size_t>(std::max(0, RuleI(Chat, DeliveryMaxQueued)));
+
+	if (MaxQueued > 0 && PendingDeliveries.size() >= MaxQueued) {
+		// a client that can't keep up loses the oldest lines rather than growing without bound
+		PendingDeliveries.pop_front();
+
+		if (DroppedDeliveries++ % 100 == 0)
+			LogInfo("Delivery queue for [{}] is full, [{}] messages dropped so far", GetName(), DroppedDeliveries);
+	}
+
+	PendingDeliveries.push_back(p);
+}
+
+void Client::FlushDeliveries() {
+
+	if (PendingDeliveries.empty())
+		return;
+
+	int Rate = RuleI(Chat, DeliveryMessagesPerSecond);
+
+	uint32 Now = Timer::GetCurrentTime();
+
+	if (Rate > 0) {
+		DeliveryBudget += static_cast<double>(Now - LastDeliveryRefill) * Rate / 1000.0;
+		DeliveryBudget = std::min(DeliveryBudget, static_cast<double>(std::max(1, RuleI(Chat, DeliveryBurst))));
+	}
+
+	LastDeliveryRefill = Now;
+
+	// queued back to back so the stream combines them into as few datagrams as it can
+	while (!PendingDeliveries.empty() && (Rate <= 0 || DeliveryBudget >= 1.0)) {
+		QueuePacket(PendingDeliveries.front().get());
+		PendingDeliveries.pop_front();
+
+		if (Rate > 0)
+			DeliveryBudget -= 1.0;
+	}
+}
+
 void Client::CloseConnection() {
 
 	ClientStream->RemoveData();
@@ -706,6 +754,11 @@ void Clientlist::Process()
 
 		++it;
 	}
+
+	// everything queued while handling this pass goes out together, so a busy channel costs each member one flush per tick
+	for (auto c : ClientChatConnections) {
+		c->FlushDeliveries();
+	}
 }
 
 void Clientlist::ProcessOPMailCommand(Client *c, std::string CommandString)
@@ -1472,11 +1525,20 @@ void Client::SendChannelMessage(std::string ChannelName, std::string Message, Cl
 
 	if (!Sender) return;
 
+	auto outapp = MakeChannelMessagePacket(ChannelName, Message, Sender, UnderfootOrLater);
+
+	QueuePacket(outapp);
+
+	safe_delete(outapp);
+}
+
+EQApplicationPacket *Client::MakeChannelMessagePacket(const std::string &ChannelName, const std::string &Message, Client *Sender, bool inUnderfootOrLater) {
+
 	std::string FQSenderName = WorldShortName + "." + Sender->GetName();
 
 	int PacketLength = ChannelName.length() + Message.length() + FQSenderName.length() + 3;
 
-	if (UnderfootOrLater)
+	if (inUnderfootOrLater)
 		PacketLength += 8;
 
 	auto outapp = new EQApplicationPacket(OP_ChannelMessage, PacketLength);
@@ -1487,12 +1549,10 @@ void Client::SendChannelMessage(std::string ChannelName, std::string Message, Cl
 	VARSTRUCT_ENCODE_STRING(PacketBuffer, FQSenderName.c_str());
 	VARSTRUCT_ENCODE_STRING(PacketBuffer, Message.c_str());
 
-	if (UnderfootOrLater)
+	if (inUnderfootOrLater)
 		VARSTRUCT_ENCODE_STRING(PacketBuffer, "SPAM:0:");
 
-	QueuePacket(outapp);
-
-	safe_delete(outapp);
+	return outapp;
 }
 
 void Client::ToggleAnnounce(std::string State)
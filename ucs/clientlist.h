@@ -24,7 +24,9 @@
 #include "../common/net/eqstream.h"
 #include "../common/rulesys.h"
 #include "chatchannel.h"
+#include <deque>
 #include <list>
+#include <memory>
 #include <vector>
 
 #define MAX_JOINED_CHANNELS 10
@@ -91,6 +93,8 @@ public:
 	void ClearCharacters() { Characters.clear(); }
 	void SendMailBoxes();
 	inline void QueuePacket(const EQApplicationPacket *p, bool ack_req=true) { ClientStream->QueuePacket(p, ack_req); }
+	void QueueDelivery(const std::shared_ptr<EQApplicationPacket> &p);
+	void FlushDeliveries();
 	std::string GetName() { if(Characters.size()) return Characters[0].Name; else return ""; }
 	void JoinChannels(std::string ChannelList);
 	void LeaveChannels(std::string ChannelList);
@@ -99,6 +103,7 @@ public:
 	void RemoveFromChannelList(ChatChannel *JoinedChannel);
 	void SendChannelMessage(std::string Message);
 	void SendChannelMessage(std::string ChannelName, std::string Message, Client *Sender);
+	static EQApplicationPacket *MakeChannelMessagePacket(const std::string &ChannelName, const std::string &Message, Client *Sender, bool inUnderfootOrLater);
 	void SendChannelMessageByNumber(std::string Message);
 	void SendChannelList();
 	void CloseConnection();
@@ -143,6 +148,7 @@ public:
 	void SetConnectionType(char c);
 	ConnectionType GetConnectionType() { return TypeOfConnection; }
 	EQ::versions::ClientVersion GetClientVersion() { return ClientVersion_; }
+	inline bool IsUnderfootOrLater() { return UnderfootOrLater; }
 
 	inline bool IsMailConnection() { return (TypeOfConnection == ConnectionTypeMail) || (TypeOfConnection == ConnectionTypeCombined); }
 	void SendNotification(int MailBoxNumber, std::string From, std::string Subject, int MessageID);
@@ -175,6 +181,12 @@ private:
 	ConnectionType TypeOfConnection;
 	EQ::versions::ClientVersion ClientVersion_;
 	bool UnderfootOrLater;
+
+	// channel messages, flushed once per Clientlist::Process within the delivery budget
+	std::deque<std::shared_ptr<EQApplicationPacket>> PendingDeliveries;
+	double DeliveryBudget;
+	uint32 LastDeliveryRefill;
+	uint32 DroppedDeliveries;
 };
 
 class Clientlist {
@@ -99,6 +99,7 @@ int main() {
 
 	/* Register Log System and Settings */
 	database.LoadLogSettings(LogSys.log_settings);
+	LogSys.SetFileLogOptions(Config->LogFileAsync, Config->LogFileQueueSize, Config->LogFileBlockWhenFull, Config->LogFileBinary);
 	LogSys.StartFileLogs();
 
 	char tmp[64];
@@ -127,6 +127,8 @@ void ClientListEntry::SetChar(uint32 iCharID, const char *iCharName)
 {
 	pcharid = iCharID;
 	strn0cpy(pname, iCharName, sizeof(pname));
+
+	client_list.ReindexCLE(this);
 }
 
 void ClientListEntry::SetOnline(ZoneServer *iZS, CLE_Status iOnline)
@@ -161,6 +163,8 @@ void ClientListEntry::SetOnline(CLE_Status iOnline)
 	if (pOnline >= CLE_Status::Online) {
 		stale = 0;
 	}
+
+	client_list.ReindexCLE(this);
 }
 
 void ClientListEntry::LSUpdate(ZoneServer *iZS)
@@ -239,6 +243,8 @@ void ClientListEntry::Update(ZoneServer *iZS, ServerClientList_Struct *scl, CLE_
 		memcpy(pLFGComments, scl->LFGComments, sizeof(pLFGComments));
 	}
 
+	client_list.ReindexCLE(this);
+
 	SetOnline(iOnline);
 }
 
@@ -255,6 +261,8 @@ void ClientListEntry::LeavingZone(ZoneServer *iZS, CLE_Status iOnline)
 	}
 	pzoneserver = 0;
 	pzone       = 0;
+
+	client_list.ReindexCLE(this);
 }
 
 void ClientListEntry::ClearVars(bool iAll)
@@ -303,6 +311,8 @@ void ClientListEntry::Camp(ZoneServer *iZS)
 	ClearVars();
 
 	stale = 0;
+
+	client_list.ReindexCLE(this);
 }
 
 bool ClientListEntry::CheckStale()
@@ -365,6 +375,8 @@ bool ClientListEntry::CheckAuth(uint32 loginserver_account_id, const char *key_p
 				padmin = pworldadmin;
 			}
 		}
+
+		client_list.ReindexCLE(this);
 		return true;
 	}
 	return false;
@@ -34,6 +34,7 @@
 #include "web_interface.h"
 #include "wguild_mgr.h"
 #include <set>
+#include <algorithm>
 
 extern WebInterfaceList web_interface;
 
@@ -44,6 +45,7 @@ ClientList::ClientList()
 : CLStale_timer(10000)
 {
 	NextCLEID = 1;
+	who_generation = 0;
 
 	m_tick.reset(new EQ::Timer(5000, true, std::bind(&ClientList::OnTick, this, std::placeholders::_1)));
 }
@@ -85,14 +87,9 @@ void ClientList::CLERemoveZSRef(ZoneServer* iZS) {
 }
 
 ClientListEntry* ClientList::GetCLE(uint32 iID) {
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
-
-	iterator.Reset();
-	while(iterator.MoreElements()) {
-		if (iterator.GetData()->GetID() == iID) {
-			return iterator.GetData();
-		}
-		iterator.Advance();
+	auto iter = cle_by_id.find(iID);
+	if (iter != cle_by_id.end()) {
+		return iter->second;
 	}
 	return 0;
 }
@@ -214,56 +211,367 @@ void ClientList::DisconnectByIP(uint32 iIP) {
 }
 
 ClientListEntry* ClientList::FindCharacter(const char* name) {
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
+	if (name == nullptr || name[0] == 0) {
+		// nameless entries (char select) aren't indexed
+		LinkedListIterator<ClientListEntry*> iterator(clientlist);
 
-	iterator.Reset();
-	while(iterator.MoreElements())
-	{
-		if (strcasecmp(iterator.GetData()->name(), name) == 0) {
-			return iterator.GetData();
+		iterator.Reset();
+		while(iterator.MoreElements())
+		{
+			if (iterator.GetData()->name()[0] == 0) {
+				return iterator.GetData();
+			}
+			iterator.Advance();
 		}
-		iterator.Advance();
+		return nullptr;
+	}
+
+	auto iter = cle_by_name.find(str_tolower(name));
+	if (iter == cle_by_name.end() || iter->second.empty()) {
+		return nullptr;
 	}
-	return nullptr;
+	return iter->second.front();
 }
 
 ClientListEntry* ClientList::FindCLEByAccountID(uint32 iAccID) {
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
+	return FindInIndex(cle_by_account_id, iAccID, &ClientListEntry::AccountID);
+}
 
-	iterator.Reset();
-	while(iterator.MoreElements()) {
-		if (iterator.GetData()->AccountID() == iAccID) {
-			return iterator.GetData();
+ClientListEntry* ClientList::FindCLEByCharacterID(uint32 iCharID) {
+	return FindInIndex(cle_by_character_id, iCharID, &ClientListEntry::CharID);
+}
+
+ClientListEntry* ClientList::FindCLEByLSID(uint32 iLSID) {
+	return FindInIndex(cle_by_ls_id, iLSID, &ClientListEntry::LSID);
+}
+
+ClientListEntry* ClientList::FindInIndex(CLEIDIndex &index, uint32 key, CLEIDGetter getter) {
+	if (key == 0) {
+		// zero ids are shared by every entry that hasn't got one yet, walk the list like before
+		LinkedListIterator<ClientListEntry*> iterator(clientlist);
+
+		iterator.Reset();
+		while(iterator.MoreElements()) {
+			if ((iterator.GetData()->*getter)() == 0) {
+				return iterator.GetData();
+			}
+			iterator.Advance();
 		}
-		iterator.Advance();
+		return nullptr;
+	}
+
+	auto iter = index.find(key);
+	if (iter == index.end() || iter->second.empty()) {
+		return nullptr;
 	}
-	return nullptr;
+	return iter->second.front();
 }
 
-ClientListEntry* ClientList::FindCLEByCharacterID(uint32 iCharID) {
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
+void ClientList::AddToBucket(std::vector<ClientListEntry *> &bucket, ClientListEntry* cle, bool at_front) {
+	if (at_front) {
+		bucket.insert(bucket.begin(), cle);
+	}
+	else {
+		bucket.push_back(cle);
+	}
+}
 
-	iterator.Reset();
-	while(iterator.MoreElements()) {
-		if (iterator.GetData()->CharID() == iCharID) {
-			return iterator.GetData();
+void ClientList::RemoveFromBucket(std::vector<ClientListEntry *> &bucket, ClientListEntry* cle) {
+	auto iter = std::find(bucket.begin(), bucket.end(), cle);
+	if (iter != bucket.end()) {
+		bucket.erase(iter);
+	}
+}
+
+/**
+ * New entries go to the same end of their buckets as they do in clientlist, so with duplicate keys
+ * (a stale CLE next to a fresh login) lookups still favor the entry the old walk found first
+ *
+ * @param cle
+ * @param at_front
+ */
+void ClientList::IndexCLE(ClientListEntry* cle, bool at_front) {
+	CLEIndexKeys keys = GetIndexKeys(cle);
+
+	cle_by_id[cle->GetID()] = cle;
+
+	if (!keys.name.empty()) {
+		AddToBucket(cle_by_name[keys.name], cle, at_front);
+	}
+	if (keys.account_id != 0) {
+		AddToBucket(cle_by_account_id[keys.account_id], cle, at_front);
+	}
+	if (keys.character_id != 0) {
+		AddToBucket(cle_by_character_id[keys.character_id], cle, at_front);
+	}
+	if (keys.ls_id != 0) {
+		AddToBucket(cle_by_ls_id[keys.ls_id], cle, at_front);
+	}
+
+	if (keys.in_world) {
+		who_in_world.insert(cle);
+		who_by_class[keys.class_].insert(cle);
+		who_by_level[keys.level].insert(cle);
+	}
+	if (keys.lfg) {
+		cle_lfg.insert(cle);
+	}
+	if (keys.admin > 0) {
+		cle_staff.insert(cle);
+	}
+	if (keys.zone != 0) {
+		cle_by_zone[keys.zone].insert(cle);
+	}
+	if (keys.guild_id != 0 && keys.guild_id != GUILD_NONE) {
+		cle_by_guild[keys.guild_id].insert(cle);
+	}
+
+	cle_index_keys[cle] = keys;
+	who_generation++;
+}
+
+/**
+ * @param index
+ * @param key
+ * @param cle
+ */
+static void RemoveFromSetIndex(std::unordered_map<uint32, std::unordered_set<ClientListEntry *>> &index, uint32 key, ClientListEntry* cle) {
+	auto bucket = index.find(key);
+	if (bucket != index.end()) {
+		bucket->second.erase(cle);
+		if (bucket->second.empty()) {
+			index.erase(bucket);
 		}
-		iterator.Advance();
 	}
-	return nullptr;
 }
 
-ClientListEntry* ClientList::FindCLEByLSID(uint32 iLSID) {
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
+void ClientList::UnindexCLE(ClientListEntry* cle) {
+	auto iter = cle_index_keys.find(cle);
+	if (iter == cle_index_keys.end()) {
+		return;
+	}
 
-	iterator.Reset();
-	while (iterator.MoreElements()) {
-		if (iterator.GetData()->LSID() == iLSID) {
-			return iterator.GetData();
+	const CLEIndexKeys &keys = iter->second;
+
+	auto id_iter = cle_by_id.find(cle->GetID());
+	if (id_iter != cle_by_id.end() && id_iter->second == cle) {
+		cle_by_id.erase(id_iter);
+	}
+
+	if (!keys.name.empty()) {
+		auto bucket = cle_by_name.find(keys.name);
+		if (bucket != cle_by_name.end()) {
+			RemoveFromBucket(bucket->second, cle);
+			if (bucket->second.empty()) {
+				cle_by_name.erase(bucket);
+			}
 		}
-		iterator.Advance();
 	}
-	return nullptr;
+
+	CLEIDIndex *indexes[] = { &cle_by_account_id, &cle_by_character_id, &cle_by_ls_id };
+	uint32 values[] = { keys.account_id, keys.character_id, keys.ls_id };
+	for (int i = 0; i < 3; ++i) {
+		if (values[i] == 0) {
+			continue;
+		}
+
+		auto bucket = indexes[i]->find(values[i]);
+		if (bucket != indexes[i]->end()) {
+			RemoveFromBucket(bucket->second, cle);
+			if (bucket->second.empty()) {
+				indexes[i]->erase(bucket);
+			}
+		}
+	}
+
+	if (keys.in_world) {
+		who_in_world.erase(cle);
+		RemoveFromSetIndex(who_by_class, keys.class_, cle);
+		RemoveFromSetIndex(who_by_level, keys.level, cle);
+	}
+	if (keys.lfg) {
+		cle_lfg.erase(cle);
+	}
+	if (keys.admin > 0) {
+		cle_staff.erase(cle);
+	}
+	if (keys.zone != 0) {
+		RemoveFromSetIndex(cle_by_zone, keys.zone, cle);
+	}
+	if (keys.guild_id != 0 && keys.guild_id != GUILD_NONE) {
+		RemoveFromSetIndex(cle_by_guild, keys.guild_id, cle);
+	}
+
+	cle_index_keys.erase(iter);
+	who_generation++;
+}
+
+void ClientList::ReindexCLE(ClientListEntry* cle) {
+	auto iter = cle_index_keys.find(cle);
+	if (iter == cle_index_keys.end()) {
+		// not in the list (yet), it gets indexed when added
+		return;
+	}
+
+	const CLEIndexKeys &keys    = iter->second;
+	CLEIndexKeys       current = GetIndexKeys(cle);
+	if (keys.account_id == current.account_id && keys.character_id == current.character_id &&
+		keys.ls_id == current.ls_id && keys.name == current.name && keys.in_world == current.in_world &&
+		keys.lfg == current.lfg && keys.zone == current.zone && keys.guild_id == current.guild_id &&
+		keys.class_ == current.class_ && keys.level == current.level && keys.admin == current.admin) {
+		return;
+	}
+
+	UnindexCLE(cle);
+	IndexCLE(cle, false);
+}
+
+ClientList::CLEIndexKeys ClientList::GetIndexKeys(ClientListEntry* cle) {
+	CLEIndexKeys keys;
+	keys.name         = str_tolower(cle->name());
+	keys.account_id   = cle->AccountID();
+	keys.character_id = cle->CharID();
+	keys.ls_id        = cle->LSID();
+	keys.in_world     = cle->Online() >= CLE_Status::Zoning;
+	keys.lfg          = cle->LFG();
+	keys.zone         = cle->zone();
+	keys.guild_id     = cle->GuildID();
+	keys.class_       = cle->class_();
+	keys.level        = cle->level();
+	keys.admin        = cle->Admin();
+
+	return keys;
+}
+
+bool ClientList::WhoAllMatches(ClientListEntry* cle, int16 admin, Who_All_Struct* whom, int whomlen) {
+	const char* tmpZone = database.GetZoneName(cle->zone());
+	return (
+	(cle->Online() >= CLE_Status::Zoning) &&
+	(!cle->GetGM() || cle->Anon() != 1 || admin >= cle->Admin()) &&
+	(whom == 0 || (
+		((cle->Admin() >= 80 && cle->GetGM()) || whom->gmlookup == 0xFFFF) &&
+		(whom->lvllow == 0xFFFF || (cle->level() >= whom->lvllow && cle->level() <= whom->lvlhigh && (cle->Anon()==0 || admin>cle->Admin()))) &&
+		(whom->wclass == 0xFFFF || (cle->class_() == whom->wclass && (cle->Anon()==0 || admin>cle->Admin()))) &&
+		(whom->wrace == 0xFFFF || (cle->race() == whom->wrace && (cle->Anon()==0 || admin>cle->Admin()))) &&
+		(whomlen == 0 || (
+			(tmpZone != 0 && strncasecmp(tmpZone, whom->whom, whomlen) == 0) ||
+			strncasecmp(cle->name(),whom->whom, whomlen) == 0 ||
+			(strncasecmp(guild_mgr.GetGuildName(cle->GuildID()), whom->whom, whomlen) == 0) ||
+			(admin >= 100 && strncasecmp(cle->AccountName(), whom->whom, whomlen) == 0)
+		))
+	))
+	);
+}
+
+/**
+ * Picks the smallest indexed set that every match must be in, sorted by CLE id so replies are stable
+ *
+ * @param whom
+ * @param into
+ */
+void ClientList::GetWhoAllCandidates(Who_All_Struct* whom, std::vector<ClientListEntry *> &into) {
+	const std::unordered_set<ClientListEntry *> *source = &who_in_world;
+
+	if (whom && whom->wclass != 0xFFFF) {
+		auto iter = who_by_class.find(whom->wclass);
+		if (iter == who_by_class.end()) {
+			return;
+		}
+		if (iter->second.size() < source->size()) {
+			source = &iter->second;
+		}
+	}
+
+	bool use_levels = false;
+	if (whom && whom->lvllow != 0xFFFF) {
+		if (whom->lvllow > 255 || whom->lvlhigh < whom->lvllow) {
+			return;
+		}
+
+		uint32 level_high  = std::min<uint32>(whom->lvlhigh, 255);
+		size_t level_count = 0;
+		for (uint32 level = whom->lvllow; level <= level_high; ++level) {
+			auto iter = who_by_level.find(level);
+			if (iter != who_by_level.end()) {
+				level_count += iter->second.size();
+			}
+		}
+
+		if (level_count < source->size()) {
+			use_levels = true;
+			into.reserve(level_count);
+			for (uint32 level = whom->lvllow; level <= level_high; ++level) {
+				auto iter = who_by_level.find(level);
+				if (iter != who_by_level.end()) {
+					into.insert(into.end(), iter->second.begin(), iter->second.end());
+				}
+			}
+		}
+	}
+
+	if (!use_levels) {
+		into.assign(source->begin(), source->end());
+	}
+
+	std::sort(
+		into.begin(), into.end(), [](ClientListEntry* a, ClientListEntry* b) {
+			return a->GetID() < b->GetID();
+		}
+	);
+}
+
+bool ClientList::GetInterestedZoneServers(uint32 guild_id, int16 min_status, std::set<ZoneServer*> &into) {
+	bool by_guild  = guild_id != 0;
+	bool by_status = min_status > 0;
+
+	if (by_guild && guild_id == GUILD_NONE) {
+		return false;
+	}
+
+	const std::unordered_set<ClientListEntry *> *source = nullptr;
+	if (by_guild) {
+		auto iter = cle_by_guild.find(guild_id);
+		if (iter == cle_by_guild.end()) {
+			return true;
+		}
+		source = &iter->second;
+	}
+	else if (by_status) {
+		source = &cle_staff;
+	}
+	else {
+		return false;
+	}
+
+	for (auto cle : *source) {
+		if (cle->Server() == nullptr || cle->Online() < CLE_Status::Zoning) {
+			continue;
+		}
+		if (by_status && cle->Admin() < min_status) {
+			continue;
+		}
+
+		into.insert(cle->Server());
+	}
+
+	return true;
+}
+
+std::string ClientList::GetWhoAllCacheKey(int16 admin, Who_All_Struct* whom) {
+	if (whom == 0) {
+		return fmt::format("{}", admin);
+	}
+
+	return fmt::format(
+		"{}:{}:{}:{}:{}:{}:{}",
+		admin,
+		whom->wrace,
+		whom->wclass,
+		whom->lvllow,
+		whom->lvlhigh,
+		whom->gmlookup,
+		str_tolower(std::string(whom->whom, strnlen(whom->whom, sizeof(whom->whom))))
+	);
 }
 
 void ClientList::SendCLEList(const int16& admin, const char* to, WorldTCPConnection* connection, const char* iName) {
@@ -318,6 +626,7 @@ void ClientList::CLEAdd(uint32 iLSID, const char *iLoginServerName, const char*
 	auto tmp = new ClientListEntry(GetNextCLEID(), iLSID, iLoginServerName, iLoginName, iLoginKey, iWorldAdmin, ip, local);
 
 	clientlist.Append(tmp);
+	IndexCLE(tmp, false);
 }
 
 void ClientList::CLCheckStale() {
@@ -334,22 +643,16 @@ void ClientList::CLCheckStale() {
 }
 
 void ClientList::ClientUpdate(ZoneServer* zoneserver, ServerClientList_Struct* scl) {
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
-	ClientListEntry* cle;
-	iterator.Reset();
-	while(iterator.MoreElements()) {
-		if (iterator.GetData()->GetID() == scl->wid) {
-			cle = iterator.GetData();
-			if (scl->remove == 2){
-				cle->LeavingZone(zoneserver, CLE_Status::Offline);
-			}
-			else if (scl->remove == 1)
-				cle->LeavingZone(zoneserver, CLE_Status::Zoning);
-			else
-				cle->Update(zoneserver, scl);
-			return;
+	ClientListEntry* cle = GetCLE(scl->wid);
+	if (cle) {
+		if (scl->remove == 2){
+			cle->LeavingZone(zoneserver, CLE_Status::Offline);
 		}
-		iterator.Advance();
+		else if (scl->remove == 1)
+			cle->LeavingZone(zoneserver, CLE_Status::Zoning);
+		else
+			cle->Update(zoneserver, scl);
+		return;
 	}
 	if (scl->remove == 2)
 		cle = new ClientListEntry(GetNextCLEID(), zoneserver, scl, CLE_Status::Online);
@@ -358,6 +661,7 @@ void ClientList::ClientUpdate(ZoneServer* zoneserver, ServerClientList_Struct* s
 	else
 		cle = new ClientListEntry(GetNextCLEID(), zoneserver, scl, CLE_Status::InZone);
 	clientlist.Insert(cle);
+	IndexCLE(cle, true);
 	zoneserver->ChangeWID(scl->charid, cle->GetID());
 }
 
@@ -403,25 +707,34 @@ void ClientList::SendOnlineGuildMembers(uint32 FromID, uint32 GuildID)
 		return;
 	}
 
-	LinkedListIterator<ClientListEntry*> Iterator(clientlist);
+	std::vector<ClientListEntry*> Members;
 
-	Iterator.Reset();
+	auto Guild = cle_by_guild.find(GuildID);
+	if (Guild != cle_by_guild.end()) {
+		Members.assign(Guild->second.begin(), Guild->second.end());
+	}
+	else if (GuildID == 0 || GuildID == GUILD_NONE) {
+		// guildless entries aren't indexed
+		LinkedListIterator<ClientListEntry*> Iterator(clientlist);
 
-	while(Iterator.MoreElements())
-	{
-		ClientListEntry* CLE = Iterator.GetData();
+		Iterator.Reset();
 
-		if(CLE && (CLE->GuildID() == GuildID))
+		while(Iterator.MoreElements())
 		{
-			PacketLength += (strlen(CLE->name()) + 5);
-			++Count;
-		}
+			ClientListEntry* CLE = Iterator.GetData();
 
-		Iterator.Advance();
+			if(CLE && (CLE->GuildID() == GuildID))
+				Members.push_back(CLE);
 
+			Iterator.Advance();
+		}
 	}
 
-	Iterator.Reset();
+	for (auto CLE : Members)
+	{
+		PacketLength += (strlen(CLE->name()) + 5);
+		++Count;
+	}
 
 	auto pack = new ServerPacket(ServerOP_OnlineGuildMembersResponse, PacketLength);
 
@@ -430,17 +743,10 @@ void ClientList::SendOnlineGuildMembers(uint32 FromID, uint32 GuildID)
 	VARSTRUCT_ENCODE_TYPE(uint32, Buffer, FromID);
 	VARSTRUCT_ENCODE_TYPE(uint32, Buffer, Count);
 
-	while(Iterator.MoreElements())
+	for (auto CLE : Members)
 	{
-		ClientListEntry* CLE = Iterator.GetData();
-
-		if(CLE && (CLE->GuildID() == GuildID))
-		{
-			VARSTRUCT_ENCODE_STRING(Buffer, CLE->name());
-			VARSTRUCT_ENCODE_TYPE(uint32, Buffer, CLE->zone());
-		}
-
-		Iterator.Advance();
+		VARSTRUCT_ENCODE_STRING(Buffer, CLE->name());
+		VARSTRUCT_ENCODE_TYPE(uint32, Buffer, CLE->zone());
 	}
 	zoneserver_list.SendPacket(from->zone(), from->instance(), pack);
 	safe_delete(pack);
@@ -449,10 +755,6 @@ void ClientList::SendOnlineGuildMembers(uint32 FromID, uint32 GuildID)
 
 void ClientList::SendWhoAll(uint32 fromid,const char* to, int16 admin, Who_All_Struct* whom, WorldTCPConnection* connection) {
 	try{
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
-	LinkedListIterator<ClientListEntry*> countclients(clientlist);
-	ClientListEntry* cle = 0;
-	ClientListEntry* countcle = 0;
 	//char tmpgm[25] = "";
 	//char accinfo[150] = "";
 	char line[300] = "";
@@ -488,6 +790,27 @@ void ClientList::SendWhoAll(uint32 fromid,const char* to, int16 admin, Who_All_S
 			whom->wrace = FROGLOK; // This is what EQEmu uses for the Froglok Race number.
 	}
 
+	std::string cache_key = GetWhoAllCacheKey(admin, whom);
+	auto cached = who_all_cache.find(cache_key);
+	if (cached != who_all_cache.end() && cached->second.generation == who_generation &&
+		Timer::GetCurrentTime() - cached->second.created < (uint32) RuleI(World, WhoAllCacheMS)) {
+		auto pack = new ServerPacket(ServerOP_WhoAllReply, cached->second.packet.size());
+		memcpy(pack->pBuffer, cached->second.packet.data(), cached->second.packet.size());
+		memcpy(pack->pBuffer, &fromid, sizeof(uint32));
+		SendPacket(to, pack);
+		safe_delete(pack);
+		return;
+	}
+
+	std::vector<ClientListEntry*> candidates;
+	std::vector<ClientListEntry*> matches;
+	GetWhoAllCandidates(whom, candidates);
+	for (auto candidate : candidates) {
+		if (WhoAllMatches(candidate, admin, whom, whomlen)) {
+			matches.push_back(candidate);
+		}
+	}
+
 	char* output = 0;
 	uint32 outsize = 0, outlen = 0;
 	uint32 totalusers=0;
@@ -497,38 +820,17 @@ void ClientList::SendWhoAll(uint32 fromid,const char* to, int16 admin, Who_All_S
 		AppendAnyLenString(&output, &outsize, &outlen, "\r\n");
 	else
 		AppendAnyLenString(&output, &outsize, &outlen, "\n");
-	countclients.Reset();
-	while(countclients.MoreElements()){
-		countcle = countclients.GetData();
-		const char* tmpZone = database.GetZoneName(countcle->zone());
-		if (
-	(countcle->Online() >= CLE_Status::Zoning) &&
-	(!countcle->GetGM() || countcle->Anon() != 1 || admin >= countcle->Admin()) &&
-	(whom == 0 || (
-		((countcle->Admin() >= 80 && countcle->GetGM()) || whom->gmlookup == 0xFFFF) &&
-		(whom->lvllow == 0xFFFF || (countcle->level() >= whom->lvllow && countcle->level() <= whom->lvlhigh && (countcle->Anon()==0 || admin > countcle->Admin()))) &&
-		(whom->wclass == 0xFFFF || (countcle->class_() == whom->wclass && (countcle->Anon()==0 || admin > countcle->Admin()))) &&
-		(whom->wrace == 0xFFFF || (countcle->race() == whom->wrace && (countcle->Anon()==0 || admin > countcle->Admin()))) &&
-		(whomlen == 0 || (
-			(tmpZone != 0 && strncasecmp(tmpZone, whom->whom, whomlen) == 0) ||
-			strncasecmp(countcle->name(),whom->whom, whomlen) == 0 ||
-			(strncasecmp(guild_mgr.GetGuildName(countcle->GuildID()), whom->whom, whomlen) == 0) ||
-			(admin >= 100 && strncasecmp(countcle->AccountName(), whom->whom, whomlen) == 0)
-		))
-	))
-) {
-			if((countcle->Anon()>0 && admin>=countcle->Admin() && admin>0) || countcle->Anon()==0 ){
-				totalusers++;
-				if(totalusers<=20 || admin>=100)
-					totallength=totallength+strlen(countcle->name())+strlen(countcle->AccountName())+strlen(guild_mgr.GetGuildName(countcle->GuildID()))+5;
-			}
-			else if((countcle->Anon()>0 && admin<=countcle->Admin()) || (countcle->Anon()==0 && !countcle->GetGM())) {
-				totalusers++;
-				if(totalusers<=20 || admin>=100)
-					totallength=totallength+strlen(countcle->name())+strlen(guild_mgr.GetGuildName(countcle->GuildID()))+5;
-			}
+	for (auto countcle : matches) {
+		if((countcle->Anon()>0 && admin>=countcle->Admin() && admin>0) || countcle->Anon()==0 ){
+			totalusers++;
+			if(totalusers<=20 || admin>=100)
+				totallength=totallength+strlen(countcle->name())+strlen(countcle->AccountName())+strlen(guild_mgr.GetGuildName(countcle->GuildID()))+5;
+		}
+		else if((countcle->Anon()>0 && admin<=countcle->Admin()) || (countcle->Anon()==0 && !countcle->GetGM())) {
+			totalusers++;
+			if(totalusers<=20 || admin>=100)
+				totallength=totallength+strlen(countcle->name())+strlen(guild_mgr.GetGuildName(countcle->GuildID()))+5;
 		}
-		countclients.Advance();
 	}
 	uint32 plid=fromid;
 	uint32 playerineqstring=5001;
@@ -575,79 +877,58 @@ void ClientList::SendWhoAll(uint32 fromid,const char* to, int16 admin, Who_All_S
 	memcpy(bufptr,&totalusers, sizeof(uint32));
 	bufptr+=sizeof(uint32);
 
-	iterator.Reset();
 	int idx=-1;
-	while(iterator.MoreElements()) {
-		cle = iterator.GetData();
-
-		const char* tmpZone = database.GetZoneName(cle->zone());
-		if (
-	(cle->Online() >= CLE_Status::Zoning) &&
-	(!cle->GetGM() || cle->Anon() != 1 || admin >= cle->Admin()) &&
-	(whom == 0 || (
-		((cle->Admin() >= 80 && cle->GetGM()) || whom->gmlookup == 0xFFFF) &&
-		(whom->lvllow == 0xFFFF || (cle->level() >= whom->lvllow && cle->level() <= whom->lvlhigh && (cle->Anon()==0 || admin>cle->Admin()))) &&
-		(whom->wclass == 0xFFFF || (cle->class_() == whom->wclass && (cle->Anon()==0 || admin>cle->Admin()))) &&
-		(whom->wrace == 0xFFFF || (cle->race() == whom->wrace && (cle->Anon()==0 || admin>cle->Admin()))) &&
-		(whomlen == 0 || (
-			(tmpZone != 0 && strncasecmp(tmpZone, whom->whom, whomlen) == 0) ||
-			strncasecmp(cle->name(),whom->whom, whomlen) == 0 ||
-			(strncasecmp(guild_mgr.GetGuildName(cle->GuildID()), whom->whom, whomlen) == 0) ||
-			(admin >= 100 && strncasecmp(cle->AccountName(), whom->whom, whomlen) == 0)
-		))
-	))
-) {
-			line[0] = 0;
-			uint32 rankstring=0xFFFFFFFF;
-				if((cle->Anon()==1 && cle->GetGM() && cle->Admin()>admin) || (idx>=20 && admin<100)){ //hide gms that are anon from lesser gms and normal players, cut off at 20
-					rankstring=0;
-					iterator.Advance();
-					continue;
-				} else if (cle->GetGM()) {
-					if (cle->Admin() >=250)
-						rankstring=5021;
-					else if (cle->Admin() >= 200)
-						rankstring=5020;
-					else if (cle->Admin() >= 180)
-						rankstring=5019;
-					else if (cle->Admin() >= 170)
-						rankstring=5018;
-					else if (cle->Admin() >= 160)
-						rankstring=5017;
-					else if (cle->Admin() >= 150)
-						rankstring=5016;
-					else if (cle->Admin() >= 100)
-						rankstring=5015;
-					else if (cle->Admin() >= 95)
-						rankstring=5014;
-					else if (cle->Admin() >= 90)
-						rankstring=5013;
-					else if (cle->Admin() >= 85)
-						rankstring=5012;
-					else if (cle->Admin() >= 81)
-						rankstring=5011;
-					else if (cle->Admin() >= 80)
-						rankstring=5010;
-					else if (cle->Admin() >= 50)
-						rankstring=5009;
-					else if (cle->Admin() >= 20)
-						rankstring=5008;
-					else if (cle->Admin() >= 10)
-						rankstring=5007;
-				}
-			idx++;
-			char guildbuffer[67]={0};
-			if (cle->GuildID() != GUILD_NONE && cle->GuildID()>0)
-				sprintf(guildbuffer,"<%s>", guild_mgr.GetGuildName(cle->GuildID()));
-			uint32 formatstring=5025;
-			if(cle->Anon()==1 && (admin<cle->Admin() || admin==0))
-				formatstring=5024;
-			else if(cle->Anon()==1 && admin>=cle->Admin() && admin>0)
-				formatstring=5022;
-			else if(cle->Anon()==2 && (admin<cle->Admin() || admin==0))
-				formatstring=5023;//display guild
-			else if(cle->Anon()==2 && admin>=cle->Admin() && admin>0)
-				formatstring=5022;//display everything
+	for (auto cle : matches) {
+		line[0] = 0;
+		uint32 rankstring=0xFFFFFFFF;
+		if((cle->Anon()==1 && cle->GetGM() && cle->Admin()>admin) || (idx>=20 && admin<100)){ //hide gms that are anon from lesser gms and normal players, cut off at 20
+			rankstring=0;
+			continue;
+		} else if (cle->GetGM()) {
+			if (cle->Admin() >=250)
+				rankstring=5021;
+			else if (cle->Admin() >= 200)
+				rankstring=5020;
+			else if (cle->Admin() >= 180)
+				rankstring=5019;
+			else if (cle->Admin() >= 170)
+				rankstring=5018;
+			else if (cle->Admin() >= 160)
+				rankstring=5017;
+			else if (cle->Admin() >= 150)
+				rankstring=5016;
+			else if (cle->Admin() >= 100)
+				rankstring=5015;
+			else if (cle->Admin() >= 95)
+				rankstring=5014;
+			else if (cle->Admin() >= 90)
+				rankstring=5013;
+			else if (cle->Admin() >= 85)
+				rankstring=5012;
+			else if (cle->Admin() >= 81)
+				rankstring=5011;
+			else if (cle->Admin() >= 80)
+				rankstring=5010;
+			else if (cle->Admin() >= 50)
+				rankstring=5009;
+			else if (cle->Admin() >= 20)
+				rankstring=5008;
+			else if (cle->Admin() >= 10)
+				rankstring=5007;
+		}
+		idx++;
+		char guildbuffer[67]={0};
+		if (cle->GuildID() != GUILD_NONE && cle->GuildID()>0)
+			sprintf(guildbuffer,"<%s>", guild_mgr.GetGuildName(cle->GuildID()));
+		uint32 formatstring=5025;
+		if(cle->Anon()==1 && (admin<cle->Admin() || admin==0))
+			formatstring=5024;
+		else if(cle->Anon()==1 && admin>=cle->Admin() && admin>0)
+			formatstring=5022;
+		else if(cle->Anon()==2 && (admin<cle->Admin() || admin==0))
+			formatstring=5023;//display guild
+		else if(cle->Anon()==2 && admin>=cle->Admin() && admin>0)
+			formatstring=5022;//display everything
 
 	//war* wars2 = (war*)pack2->pBuffer;
 
@@ -715,9 +996,19 @@ void ClientList::SendWhoAll(uint32 fromid,const char* to, int16 admin, Who_All_S
 	ending=207;
 	memcpy(bufptr,&ending, sizeof(uint32));
 	bufptr+=sizeof(uint32);
+	}
+
+	if (RuleI(World, WhoAllCacheMS) > 0) {
+		if (who_all_cache.size() >= 64) {
+			who_all_cache.clear();
 		}
-		iterator.Advance();
+
+		WhoAllCacheEntry &entry = who_all_cache[cache_key];
+		entry.generation = who_generation;
+		entry.created    = Timer::GetCurrentTime();
+		entry.packet.assign(pack2->pBuffer, pack2->pBuffer + pack2->size);
 	}
+
 	//zoneserver_list.SendPacket(pack2); // NO NO NO WHY WOULD YOU SEND IT TO EVERY ZONE SERVER?!?
 	SendPacket(to,pack2);
 	safe_delete(pack2);
@@ -876,35 +1167,33 @@ void ClientList::SendLFGMatches(ServerLFGMatchesRequest_Struct *smrs) {
 
 	// Send back matches when someone searches player's Looking For A Group.
 
-	LinkedListIterator<ClientListEntry*> Iterator(clientlist);
-	ClientListEntry* CLE = 0;
-	int Matches = 0;
-
-	Iterator.Reset();
+	std::vector<ClientListEntry*> Matched;
+
+	for (auto CLE : cle_lfg) {
+		unsigned int BitMask = 1 << CLE->class_();
+		// First we check that the player meets the level and class criteria of the person
+		// doing the search.
+		if((CLE->level() >= smrs->FromLevel) && (CLE->level() <= smrs->ToLevel) &&
+			(BitMask & smrs->Classes))
+			// Then we check if if the player doing the search meets the level criteria specified
+			// by the player who is LFG.
+			//
+			// GetLFGMatchFilter returns the setting of the 'Only players who match my posted filters
+			//						can query me' checkbox.
+			//
+			// FromLevel and ToLevel are the settings of the 'Want group levels:' boxes.
+			if(!CLE->GetLFGMatchFilter() || ((smrs->QuerierLevel >= CLE->GetLFGFromLevel()) &&
+							(smrs->QuerierLevel <= CLE->GetLFGToLevel())))
+				Matched.push_back(CLE);
+	}
 
-	// We run the ClientList twice. The first time is to determine how big the outgoing packet needs to be.
-	while(Iterator.MoreElements()) {
-		CLE = Iterator.GetData();
-		if(CLE->LFG()) {
-			unsigned int BitMask = 1 << CLE->class_();
-			// First we check that the player meets the level and class criteria of the person
-			// doing the search.
-			if((CLE->level() >= smrs->FromLevel) && (CLE->level() <= smrs->ToLevel) &&
-				(BitMask & smrs->Classes))
-				// Then we check if if the player doing the search meets the level criteria specified
-				// by the player who is LFG.
-				//
-				// GetLFGMatchFilter returns the setting of the 'Only players who match my posted filters
-				//						can query me' checkbox.
-				//
-				// FromLevel and ToLevel are the settings of the 'Want group levels:' boxes.
-				if(!CLE->GetLFGMatchFilter() || ((smrs->QuerierLevel >= CLE->GetLFGFromLevel()) &&
-								(smrs->QuerierLevel <= CLE->GetLFGToLevel())))
-					Matches++;
+	std::sort(
+		Matched.begin(), Matched.end(), [](ClientListEntry* a, ClientListEntry* b) {
+			return a->GetID() < b->GetID();
 		}
-		Iterator.Advance();
-	}
-	auto Pack = new ServerPacket(ServerOP_LFGMatches, (sizeof(ServerLFGMatchesResponse_Struct) * Matches) + 4);
+	);
+
+	auto Pack = new ServerPacket(ServerOP_LFGMatches, (sizeof(ServerLFGMatchesResponse_Struct) * Matched.size()) + 4);
 
 	char *Buf = (char *)Pack->pBuffer;
 	// FromID is the Entity ID of the player doing the search.
@@ -912,31 +1201,18 @@ void ClientList::SendLFGMatches(ServerLFGMatchesRequest_Struct *smrs) {
 
 	ServerLFGMatchesResponse_Struct* Buffer = (ServerLFGMatchesResponse_Struct*)Buf;
 
-	Iterator.Reset();
-
-	if(Matches) {
-		while(Iterator.MoreElements() && (Matches > 0)) {
-			CLE = Iterator.GetData();
-			if(CLE->LFG()) {
-				unsigned int BitMask = 1 << CLE->class_();
-				if((CLE->level() >= smrs->FromLevel) && (CLE->level() <= smrs->ToLevel) &&
-					(BitMask & smrs->Classes)) {
-					Matches--;
-					strcpy(Buffer->Name, CLE->name());
-					Buffer->Class_ = CLE->class_();
-					Buffer->Level = CLE->level();
-					Buffer->Zone = CLE->zone();
-					// If the LFG player is anon, level and class are still displayed, but
-					// zone shows as UNAVAILABLE.
-					Buffer->Anon = (CLE->Anon() != 0);
-					// The client can filter on Guildname
-					Buffer->GuildID = CLE->GuildID();
-					strcpy(Buffer->Comments, CLE->GetLFGComments());
-					Buffer++;
-				}
-			}
-			Iterator.Advance();
-		}
+	for (auto CLE : Matched) {
+		strcpy(Buffer->Name, CLE->name());
+		Buffer->Class_ = CLE->class_();
+		Buffer->Level = CLE->level();
+		Buffer->Zone = CLE->zone();
+		// If the LFG player is anon, level and class are still displayed, but
+		// zone shows as UNAVAILABLE.
+		Buffer->Anon = (CLE->Anon() != 0);
+		// The client can filter on Guildname
+		Buffer->GuildID = CLE->GuildID();
+		strcpy(Buffer->Comments, CLE->GetLFGComments());
+		Buffer++;
 	}
 	SendPacket(smrs->FromName,Pack);
 	safe_delete(Pack);
@@ -1162,6 +1438,8 @@ void ClientList::ZoneBootup(ZoneServer* zs) {
 }
 
 void ClientList::RemoveCLEReferances(ClientListEntry* cle) {
+	UnindexCLE(cle);
+
 	LinkedListIterator<Client*> iterator(list);
 
 	iterator.Reset();
@@ -1227,15 +1505,20 @@ void ClientList::SendGuildPacket(uint32 guild_id, ServerPacket* pack) {
 }
 
 void ClientList::UpdateClientGuild(uint32 char_id, uint32 guild_id) {
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
+	if (char_id == 0) {
+		return;
+	}
 
-	iterator.Reset();
-	while(iterator.MoreElements()) {
-		ClientListEntry *cle = iterator.GetData();
-		if (cle->CharID() == char_id) {
-			cle->SetGuild(guild_id);
-		}
-		iterator.Advance();
+	auto iter = cle_by_character_id.find(char_id);
+	if (iter == cle_by_character_id.end()) {
+		return;
+	}
+
+	// copy, reindexing can reorder the bucket
+	std::vector<ClientListEntry *> entries = iter->second;
+	for (auto cle : entries) {
+		cle->SetGuild(guild_id);
+		ReindexCLE(cle);
 	}
 }
 
@@ -1283,11 +1566,19 @@ void ClientList::GetClients(const char *zone_name, std::vector<ClientListEntry *
 		}
 	} else {
 		uint32 zoneid = database.GetZoneID(zone_name);
-		while(iterator.MoreElements()) {
-			ClientListEntry* tmp = iterator.GetData();
-			if(tmp->zone() == zoneid)
-				res.push_back(tmp);
-			iterator.Advance();
+		if (zoneid == 0) {
+			while(iterator.MoreElements()) {
+				ClientListEntry* tmp = iterator.GetData();
+				if(tmp->zone() == zoneid)
+					res.push_back(tmp);
+				iterator.Advance();
+			}
+			return;
+		}
+
+		auto zone_clients = cle_by_zone.find(zoneid);
+		if (zone_clients != cle_by_zone.end()) {
+			res.insert(res.end(), zone_clients->second.begin(), zone_clients->second.end());
 		}
 	}
 }
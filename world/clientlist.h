@@ -11,6 +11,9 @@
 #include "../common/net/console_server_connection.h"
 #include <vector>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <set>
 
 class Client;
 class ZoneServer;
@@ -35,6 +38,23 @@ public:
 	void	ZoneBootup(ZoneServer* zs);
 	void	RemoveCLEReferances(ClientListEntry* cle);
 
+	/**
+	 * Must be called whenever a listed CLE changes its name, account, character or LS id
+	 *
+	 * @param cle
+	 */
+	void	ReindexCLE(ClientListEntry* cle);
+
+	/**
+	 * Collects the zones holding a character a guild and/or status filtered broadcast can reach
+	 *
+	 * @param guild_id
+	 * @param min_status
+	 * @param into
+	 * @return false when the filter isn't indexed and the caller should send to every zone
+	 */
+	bool	GetInterestedZoneServers(uint32 guild_id, int16 min_status, std::set<ZoneServer*> &into);
+
 
 	//from ZSList
 
@@ -76,12 +96,72 @@ private:
 	void OnTick(EQ::Timer *t);
 	inline uint32 GetNextCLEID() { return NextCLEID++; }
 
+	struct CLEIndexKeys {
+		std::string name;
+		uint32 account_id;
+		uint32 character_id;
+		uint32 ls_id;
+
+		// who/lfg/guild filters
+		bool in_world;
+		bool lfg;
+		uint32 zone;
+		uint32 guild_id;
+		uint8 class_;
+		uint8 level;
+		int16 admin;
+	};
+
+	struct WhoAllCacheEntry {
+		uint32 generation;
+		uint32 created;
+		std::vector<uchar> packet;
+	};
+
+	typedef std::unordered_map<uint32, std::vector<ClientListEntry *>> CLEIDIndex;
+	typedef std::unordered_map<uint32, std::unordered_set<ClientListEntry *>> CLESetIndex;
+	typedef uint32 (ClientListEntry::*CLEIDGetter)() const;
+
+	static CLEIndexKeys GetIndexKeys(ClientListEntry* cle);
+	static bool WhoAllMatches(ClientListEntry* cle, int16 admin, Who_All_Struct* whom, int whomlen);
+	void GetWhoAllCandidates(Who_All_Struct* whom, std::vector<ClientListEntry *> &into);
+	static std::string GetWhoAllCacheKey(int16 admin, Who_All_Struct* whom);
+
+	void IndexCLE(ClientListEntry* cle, bool at_front);
+	void UnindexCLE(ClientListEntry* cle);
+	static void AddToBucket(std::vector<ClientListEntry *> &bucket, ClientListEntry* cle, bool at_front);
+	static void RemoveFromBucket(std::vector<ClientListEntry *> &bucket, ClientListEntry* cle);
+	ClientListEntry* FindInIndex(CLEIDIndex &index, uint32 key, CLEIDGetter getter);
+
 	//this is the list of people actively connected to zone
 	LinkedList<Client*> list;
 
 	//this is the list of people in any zone, not nescesarily connected to world
 	Timer	CLStale_timer;
 	uint32 NextCLEID;
+
+	// lookup indexes over clientlist, declared first so they outlive its entries on shutdown
+	std::unordered_map<ClientListEntry *, CLEIndexKeys> cle_index_keys;
+	std::unordered_map<uint32, ClientListEntry *> cle_by_id;
+	std::unordered_map<std::string, std::vector<ClientListEntry *>> cle_by_name;
+	CLEIDIndex cle_by_account_id;
+	CLEIDIndex cle_by_character_id;
+	CLEIDIndex cle_by_ls_id;
+
+	// characters in a zone (Zoning or InZone), the only ones /who can list
+	std::unordered_set<ClientListEntry *> who_in_world;
+	CLESetIndex who_by_class;
+	CLESetIndex who_by_level;
+	CLESetIndex cle_by_zone;
+	CLESetIndex cle_by_guild;
+	std::unordered_set<ClientListEntry *> cle_lfg;
+	// entries with a status above zero, the only ones status filtered broadcasts can reach
+	std::unordered_set<ClientListEntry *> cle_staff;
+
+	// bumped whenever an entry is indexed or dropped, invalidates cached /who replies
+	uint32 who_generation;
+	std::unordered_map<std::string, WhoAllCacheEntry> who_all_cache;
+
 	LinkedList<ClientListEntry *> clientlist;
 
 
@@ -18,6 +18,8 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 #include "../common/global_define.h"
 #include "zonelist.h"
 #include "zoneserver.h"
+#include "clientlist.h"
+#include "cliententry.h"
 #include "worlddb.h"
 #include "world_config.h"
 #include "../common/misc_functions.h"
@@ -32,6 +34,7 @@ extern uint32 numzones;
 extern bool holdzones;
 extern EQ::Random emu_random;
 extern WebInterfaceList web_interface;
+extern ClientList client_list;
 volatile bool UCSServerAvailable_ = false;
 void CatchSignal(int sig_num);
 
@@ -122,6 +125,25 @@ bool ZSList::SendPacket(ServerPacket* pack) {
 	return true;
 }
 
+/**
+ * Sends a guild and/or status filtered broadcast only to zones that have someone it can reach
+ *
+ * @param guild_id
+ * @param min_status
+ * @param pack
+ */
+void ZSList::SendPacketToInterestedZones(uint32 guild_id, int16 min_status, ServerPacket* pack) {
+	std::set<ZoneServer*> zones;
+	if (!client_list.GetInterestedZoneServers(guild_id, min_status, zones)) {
+		SendPacket(pack);
+		return;
+	}
+
+	for (auto zs : zones) {
+		zs->SendPacket(pack);
+	}
+}
+
 bool ZSList::SendPacket(uint32 ZoneID, ServerPacket* pack) {
 	auto iterator = zone_server_list.begin();
 	while (iterator != zone_server_list.end()) {
@@ -333,7 +355,7 @@ void ZSList::SendZoneStatus(const char* to, int16 admin, WorldTCPConnection* con
 			}
 
 			AppendAnyLenString(&output, &outsize, &outlen,
-				"#%-3i :: %s :: %15s:%-5i :: %2i :: %s:%i :: %s :: (%u)",
+				"#%-3i :: %s :: %15s:%-5i :: %2i :: %s:%i :: %s :: (%u) :: %llu KB sent, %llu B/s in %llu writes/s",
 				zone_server_data->GetID(),
 				is_static_string,
 				addr.c_str(),
@@ -342,7 +364,10 @@ void ZSList::SendZoneStatus(const char* to, int16 admin, WorldTCPConnection* con
 				zone_server_data->GetCAddress(),
 				zone_server_data->GetCPort(),
 				zone_data_string,
-				zone_server_data->GetZoneOSProcessID()
+				zone_server_data->GetZoneOSProcessID(),
+				static_cast<unsigned long long>(zone_server_data->GetBytesWritten() / 1024),
+				static_cast<unsigned long long>(zone_server_data->GetBytesPerSecond()),
+				static_cast<unsigned long long>(zone_server_data->GetSocketWritesPerSecond())
 				);
 
 			if (outlen >= 3584) {
@@ -493,10 +518,16 @@ void ZSList::SendEmoteMessageRaw(const char* to, uint32 to_guilddbid, int16 to_m
 		strn0cpy(tempto, to, 64);
 
 	if (tempto[0] == 0) {
-		SendPacket(pack);
+		SendPacketToInterestedZones(to_guilddbid, to_minstatus, pack);
 	}
 	else {
 		ZoneServer* zs = FindByName(to);
+		if (zs == 0) {
+			ClientListEntry* cle = client_list.FindCharacter(to);
+			if (cle != 0) {
+				zs = cle->Server();
+			}
+		}
 
 		if (zs != 0)
 			zs->SendPacket(pack);
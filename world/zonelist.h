@@ -28,6 +28,7 @@ public:
 	bool SendPacket(ServerPacket *pack);
 	bool SendPacket(uint32 zoneid, ServerPacket *pack);
 	bool SendPacket(uint32 zoneid, uint16 instanceid, ServerPacket *pack);
+	void SendPacketToInterestedZones(uint32 guild_id, int16 min_status, ServerPacket *pack);
 	bool SetLockedZone(uint16 iZoneID, bool iLock);
 
 	EQTime worldclock;
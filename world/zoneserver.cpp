@@ -501,7 +501,22 @@ void ZoneServer::HandleMessage(uint16 opcode, const EQ::Net::Packet &p) {
 					});
 				}
 			}
-			zoneserver_list.SendPacket(pack);
+
+			if (scm->deliverto[0] != 0) {
+				ClientListEntry* cle = client_list.FindCharacter(scm->deliverto);
+				if (cle && cle->Server()) {
+					cle->Server()->SendPacket(pack);
+				}
+				else {
+					zoneserver_list.SendPacket(pack);
+				}
+			}
+			else if (scm->chan_num == ChatChannel_Guild) {
+				zoneserver_list.SendPacketToInterestedZones(scm->guilddbid, 0, pack);
+			}
+			else {
+				zoneserver_list.SendPacket(pack);
+			}
 		}
 		break;
 	}
@@ -885,8 +900,10 @@ void ZoneServer::HandleMessage(uint16 opcode, const EQ::Net::Packet &p) {
 
 	case ServerOP_FlagUpdate: {
 		ClientListEntry* cle = client_list.FindCLEByAccountID(*((uint32*)pack->pBuffer));
-		if (cle)
+		if (cle) {
 			cle->SetAdmin(*((int16*)&pack->pBuffer[4]));
+			client_list.ReindexCLE(cle);
+		}
 		zoneserver_list.SendPacket(pack);
 		break;
 	}
@@ -1232,6 +1249,8 @@ void ZoneServer::HandleMessage(uint16 opcode, const EQ::Net::Packet &p) {
 	case ServerOP_QSPlayerLogMoves:
 	case ServerOP_QSPlayerLogMerchantTransactions:
 	case ServerOP_QSPlayerDropItem:
+	case ServerOP_QSPlayerLogEvent:
+	case ServerOP_QSPlayerAARate:
 	{
 		QSLink.SendPacket(pack);
 		break;
@@ -60,6 +60,9 @@ public:
 	inline bool         IsConnected() const { return tcpc->Handle() ? tcpc->Handle()->IsConnected() : false; }
 	inline std::string	GetIP() const		{ return tcpc->Handle() ? tcpc->Handle()->RemoteIP() : ""; }
 	inline uint16		GetPort() const		{ return tcpc->Handle() ? tcpc->Handle()->RemotePort() : 0; }
+	inline uint64		GetBytesWritten() const { return tcpc->Handle() ? tcpc->Handle()->GetStats().bytes_written : 0; }
+	inline uint64		GetBytesPerSecond() const { return tcpc->Handle() ? tcpc->Handle()->GetBytesPerSecond() : 0; }
+	inline uint64		GetSocketWritesPerSecond() const { return tcpc->Handle() ? tcpc->Handle()->GetSocketWritesPerSecond() : 0; }
 	inline const char*	GetCAddress() const	{ return client_address; }
 	inline const char*	GetCLocalAddress() const { return client_local_address; }
 	inline uint16		GetCPort() const	{ return client_port; }
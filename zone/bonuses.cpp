@@ -80,6 +80,7 @@ void Client::CalcBonuses()
 	CalcEdibleBonuses(&itembonuses);
 	CalcSpellBonuses(&spellbonuses);
 	CalcAABonuses(&aabonuses);
+	focus_index_dirty = true;
 
 	ProcessItemCaps(); // caps that depend on spell/aa bonuses
 
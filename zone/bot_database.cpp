@@ -778,6 +778,7 @@ bool BotDatabase::LoadBuffs(Bot* bot_inst)
 		bot_buffs[buff_count].casterid = 0;
 		++buff_count;
 	}
+	bot_inst->SyncBuffEffects();
 
 	return true;
 }
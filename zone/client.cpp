@@ -304,6 +304,7 @@ Client::Client(EQStreamInterface* ieqs)
 	PendingGuildInvitation = false;
 
 	current_endurance = 0;
+	focus_index_dirty = true;
 
 	InitializeBuffSlots();
 
@@ -1640,6 +1640,17 @@ private:
 
 	bool interrogateinv_flag; // used to minimize log spamming by players
 
+	// item and AA focus sources grouped by focusType, so GetFocusEffect only runs
+	// CalcFocusEffect on foci that can apply. CalcBonuses marks it dirty.
+	struct FocusSource {
+		uint16 focus_id;
+		const EQ::ItemData *item; // equipped item named in the focus message
+	};
+	std::vector<FocusSource> item_focus_index[HIGHEST_FOCUS + 1];
+	std::vector<int> aa_focus_index[HIGHEST_FOCUS + 1];
+	bool focus_index_dirty;
+	void RebuildFocusIndex();
+
 	void InterrogateInventory_(bool errorcheck, Client* requester, int16 head, int16 index, const EQ::ItemInstance* inst, const EQ::ItemInstance* parent, bool log, bool silent, bool &error, int depth);
 	bool InterrogateInventory_error(int16 head, int16 index, const EQ::ItemInstance* inst, const EQ::ItemInstance* parent, int depth);
 
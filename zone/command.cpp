@@ -11715,17 +11715,13 @@ void command_emoteview(Client *c, const Seperator *sep)
 		int count=0;
 		int emoteid = c->GetTarget()->CastToNPC()->GetEmoteID();
 
-		LinkedListIterator<NPC_Emote_Struct*> iterator(zone->NPCEmoteList);
-		iterator.Reset();
-		while(iterator.MoreElements())
+		for (auto &nes : zone->NPCEmoteList)
 		{
-			NPC_Emote_Struct* nes = iterator.GetData();
-			if(emoteid == nes->emoteid)
+			if(emoteid == nes.emoteid)
 			{
-				c->Message(Chat::White, "EmoteID: %i Event: %i Type: %i Text: %s",  nes->emoteid, nes->event_, nes->type, nes->text);
+				c->Message(Chat::White, "EmoteID: %i Event: %i Type: %i Text: %s",  nes.emoteid, nes.event_, nes.type, nes.text);
 				count++;
 			}
-			iterator.Advance();
 		}
 		if (count == 0)
 			c->Message(Chat::White, "No emotes found.");
@@ -11746,17 +11742,13 @@ void command_emotesearch(Client *c, const Seperator *sep)
 		if (Seperator::IsNumber(search_criteria))
 		{
 			uint16 emoteid = atoi(search_criteria);
-			LinkedListIterator<NPC_Emote_Struct*> iterator(zone->NPCEmoteList);
-			iterator.Reset();
-			while(iterator.MoreElements())
+			for (auto &nes : zone->NPCEmoteList)
 			{
-			NPC_Emote_Struct* nes = iterator.GetData();
-				if(emoteid == nes->emoteid)
+				if(emoteid == nes.emoteid)
 				{
-					c->Message(Chat::White, "EmoteID: %i Event: %i Type: %i Text: %s",  nes->emoteid, nes->event_, nes->type, nes->text);
+					c->Message(Chat::White, "EmoteID: %i Event: %i Type: %i Text: %s",  nes.emoteid, nes.event_, nes.type, nes.text);
 					count++;
 				}
-				iterator.Advance();
 			}
 			if (count == 0)
 				c->Message(Chat::White, "No emotes found.");
@@ -11771,23 +11763,18 @@ void command_emotesearch(Client *c, const Seperator *sep)
 			strupr(sCriteria);
 			char* pdest;
 
-			LinkedListIterator<NPC_Emote_Struct*> iterator(zone->NPCEmoteList);
-			iterator.Reset();
-			while(iterator.MoreElements())
+			for (auto &nes : zone->NPCEmoteList)
 			{
-			NPC_Emote_Struct* nes = iterator.GetData();
-			strn0cpy(sText, nes->text, sizeof(sText));
+			strn0cpy(sText, nes.text, sizeof(sText));
 			strupr(sText);
 			pdest = strstr(sText, sCriteria);
 				if (pdest != nullptr)
 				{
-					c->Message(Chat::White, "EmoteID: %i Event: %i Type: %i Text: %s",  nes->emoteid, nes->event_, nes->type, nes->text);
+					c->Message(Chat::White, "EmoteID: %i Event: %i Type: %i Text: %s",  nes.emoteid, nes.event_, nes.type, nes.text);
 					count++;
 				}
 				if (count == 50)
 					break;
-
-				iterator.Advance();
 			}
 			if (count == 50)
 				c->Message(Chat::White, "50 emotes shown...too many results.");
@@ -11799,8 +11786,7 @@ void command_emotesearch(Client *c, const Seperator *sep)
 
 void command_reloademote(Client *c, const Seperator *sep)
 {
-	zone->NPCEmoteList.Clear();
-	zone->LoadNPCEmotes(&zone->NPCEmoteList);
+	zone->LoadNPCEmotes();
 	c->Message(Chat::White, "NPC emotes reloaded.");
 }
 
@@ -21,6 +21,7 @@
 #include <stdarg.h>
 #include <string.h>
 #include <iostream>
+#include <algorithm>
 
 #ifdef _WINDOWS
 #include <process.h>
@@ -305,7 +306,8 @@ EntityList::EntityList()
 	corpse_timer(2000),
 	group_timer(1000),
 	raid_timer(1000),
-	trap_timer(1000)
+	trap_timer(1000),
+	locality_grids_dirty(true)
 {
 	// set up ids between 1 and 1500
 	// neither client or server performs well if you have
@@ -3611,6 +3613,7 @@ void EntityList::AddProximity(NPC *proximity_for)
 	RemoveProximity(proximity_for->GetID());
 
 	proximity_list.push_back(proximity_for);
+	locality_grids_dirty = true;
 
 	proximity_for->proximity = new NPCProximity; // deleted in NPC::~NPC
 }
@@ -3623,21 +3626,39 @@ bool EntityList::RemoveProximity(uint16 delete_npc_id)
 		return false;
 
 	proximity_list.erase(it);
+	locality_grids_dirty = true;
 	return true;
 }
 
 void EntityList::RemoveAllLocalities()
 {
 	proximity_list.clear();
+	locality_grids_dirty = true;
 }
 
-struct quest_proximity_event {
-	QuestEventID event_id;
-	Client *client;
-	NPC *npc;
-	int area_id;
-	int area_type;
-};
+void EntityList::RebuildLocalityGrids()
+{
+	proximity_grid.Clear();
+	proximity_volumes.clear();
+	for (auto npc : proximity_list) {
+		NPCProximity *l = npc->proximity;
+		if (l == nullptr) {
+			continue;
+		}
+
+		proximity_grid.Insert(static_cast<uint32>(proximity_volumes.size()), l->min_x, l->max_x, l->min_y, l->max_y);
+		proximity_volumes.push_back(npc);
+	}
+
+	area_grid.Clear();
+	area_volumes.clear();
+	for (auto &a : area_list) {
+		area_grid.Insert(static_cast<uint32>(area_volumes.size()), a.min_x, a.max_x, a.min_y, a.max_y);
+		area_volumes.push_back(a);
+	}
+
+	locality_grids_dirty = false;
+}
 
 void EntityList::ProcessMove(Client *c, const glm::vec3& location)
 {
@@ -3645,9 +3666,22 @@ void EntityList::ProcessMove(Client *c, const glm::vec3& location)
 	float last_y = c->ProximityY();
 	float last_z = c->ProximityZ();
 
-	std::list<quest_proximity_event> events;
-	for (auto iter = proximity_list.begin(); iter != proximity_list.end(); ++iter) {
-		NPC *d = (*iter);
+	if (locality_grids_dirty) {
+		RebuildLocalityGrids();
+	}
+
+	// quest events below can move clients and re-enter this function, so take the buffer while we use it
+	std::vector<quest_proximity_event> events;
+	events.swap(locality_events);
+	events.clear();
+
+	// only volumes covering the old or new location can produce an event, visit them in insertion order
+	locality_candidates.clear();
+	proximity_grid.Query(last_x, last_y, location.x, location.y, locality_candidates);
+	std::sort(locality_candidates.begin(), locality_candidates.end());
+
+	for (auto index : locality_candidates) {
+		NPC *d = proximity_volumes[index];
 		NPCProximity *l = d->proximity;
 		if (l == nullptr)
 			continue;
@@ -3686,8 +3720,12 @@ void EntityList::ProcessMove(Client *c, const glm::vec3& location)
 		}
 	}
 
-	for (auto iter = area_list.begin(); iter != area_list.end(); ++iter) {
-		Area& a = (*iter);
+	locality_candidates.clear();
+	area_grid.Query(last_x, last_y, location.x, location.y, locality_candidates);
+	std::sort(locality_candidates.begin(), locality_candidates.end());
+
+	for (auto index : locality_candidates) {
+		Area& a = area_volumes[index];
 		bool old_in = true;
 		bool new_in = true;
 		if (last_x < a.min_x || last_x > a.max_x ||
@@ -3735,6 +3773,9 @@ void EntityList::ProcessMove(Client *c, const glm::vec3& location)
 			parse->EventPlayer(evt.event_id, evt.client, "", 0, &args);
 		}
 	}
+
+	events.clear();
+	locality_events.swap(events);
 }
 
 void EntityList::ProcessMove(NPC *n, float x, float y, float z) {
@@ -3742,11 +3783,25 @@ void EntityList::ProcessMove(NPC *n, float x, float y, float z) {
 	float last_y = n->GetY();
 	float last_z = n->GetZ();
 
-	std::list<quest_proximity_event> events;
+	if (locality_grids_dirty) {
+		RebuildLocalityGrids();
+	}
+
+	if (area_grid.Empty()) {
+		return;
+	}
 
-	for (auto iter = area_list.begin(); iter != area_list.end(); ++iter) {
+	std::vector<quest_proximity_event> events;
+	events.swap(locality_events);
+	events.clear();
 
-		Area &a     = (*iter);
+	locality_candidates.clear();
+	area_grid.Query(last_x, last_y, x, y, locality_candidates);
+	std::sort(locality_candidates.begin(), locality_candidates.end());
+
+	for (auto index : locality_candidates) {
+
+		Area &a     = area_volumes[index];
 		bool old_in = true;
 		bool new_in = true;
 		if (last_x < a.min_x || last_x > a.max_x ||
@@ -3790,6 +3845,9 @@ void EntityList::ProcessMove(NPC *n, float x, float y, float z) {
 		args.push_back(&evt.area_type);
 		parse->EventNPC(evt.event_id, evt.npc, evt.client, "", 0, &args);
 	}
+
+	events.clear();
+	locality_events.swap(events);
 }
 
 void EntityList::AddArea(int id, int type, float min_x, float max_x, float min_y,
@@ -3824,6 +3882,7 @@ void EntityList::AddArea(int id, int type, float min_x, float max_x, float min_y
 	}
 
 	area_list.push_back(a);
+	locality_grids_dirty = true;
 }
 
 void EntityList::RemoveArea(int id)
@@ -3834,11 +3893,13 @@ void EntityList::RemoveArea(int id)
 		return;
 
 	area_list.erase(it);
+	locality_grids_dirty = true;
 }
 
 void EntityList::ClearAreas()
 {
 	area_list.clear();
+	locality_grids_dirty = true;
 }
 
 void EntityList::ProcessProximitySay(const char *Message, Client *c, uint8 language)
@@ -3846,9 +3907,26 @@ void EntityList::ProcessProximitySay(const char *Message, Client *c, uint8 langu
 	if (!Message || !c)
 		return;
 
-	auto iter = proximity_list.begin();
-	for (; iter != proximity_list.end(); ++iter) {
-		NPC *d = (*iter);
+	if (locality_grids_dirty) {
+		RebuildLocalityGrids();
+	}
+
+	// copy the candidates, say events can change the proximity lists
+	std::vector<uint32> candidates;
+	proximity_grid.Query(c->GetX(), c->GetY(), candidates);
+	std::sort(candidates.begin(), candidates.end());
+
+	std::vector<NPC *> npcs;
+	npcs.reserve(candidates.size());
+	for (auto index : candidates) {
+		npcs.push_back(proximity_volumes[index]);
+	}
+
+	for (auto d : npcs) {
+		// an earlier event changed the lists, make sure this npc is still registered
+		if (locality_grids_dirty && std::find(proximity_list.begin(), proximity_list.end(), d) == proximity_list.end())
+			continue;
+
 		NPCProximity *l = d->proximity;
 		if (l == nullptr || !l->say)
 			continue;
@@ -30,6 +30,8 @@
 #include "position.h"
 #include "zonedump.h"
 #include "common.h"
+#include "event_codes.h"
+#include "locality_grid.h"
 
 class Encounter;
 class Beacon;
@@ -137,6 +139,14 @@ private:
 	time_t spawn_timestamp;
 };
 
+struct quest_proximity_event {
+	QuestEventID event_id;
+	Client *client;
+	NPC *npc;
+	int area_id;
+	int area_type;
+};
+
 class EntityList
 {
 public:
@@ -541,6 +551,7 @@ protected:
 private:
 	void	AddToSpawnQueue(uint16 entityid, NewSpawn_Struct** app);
 	void	CheckSpawnQueue();
+	void	RebuildLocalityGrids();
 
 	//used for limiting spawns
 	class SpawnLimitRecord { public: uint32 spawngroup_id; uint32 npc_type; };
@@ -566,6 +577,15 @@ private:
 	std::list<Area> area_list;
 	std::queue<uint16> free_ids;
 
+	// proximity and area volumes bucketed by location, rebuilt lazily after the lists change
+	LocalityGrid proximity_grid;
+	LocalityGrid area_grid;
+	std::vector<NPC *> proximity_volumes;
+	std::vector<Area> area_volumes;
+	bool locality_grids_dirty;
+	std::vector<uint32> locality_candidates;
+	std::vector<quest_proximity_event> locality_events;
+
 	Timer object_timer;
 	Timer door_timer;
 	Timer corpse_timer;
@@ -0,0 +1,119 @@
+#include "locality_grid.h"
+
+#include <algorithm>
+#include <cmath>
+
+LocalityGrid::LocalityGrid(float cell_size, int max_cells_per_volume)
+{
+	m_cell_size = cell_size > 1.0f ? cell_size : 1.0f;
+	m_max_cells_per_volume = max_cells_per_volume;
+	m_count = 0;
+	m_query_stamp = 0;
+}
+
+void LocalityGrid::Clear()
+{
+	m_cells.clear();
+	m_large.clear();
+	m_stamps.clear();
+	m_count = 0;
+}
+
+void LocalityGrid::Insert(uint32 index, float min_x, float max_x, float min_y, float max_y)
+{
+	if (index >= m_stamps.size()) {
+		m_stamps.resize(index + 1, 0);
+	}
+
+	m_count++;
+
+	int32 min_cx = CellCoord(min_x);
+	int32 max_cx = CellCoord(max_x);
+	int32 min_cy = CellCoord(min_y);
+	int32 max_cy = CellCoord(max_y);
+
+	int64 cells = (static_cast<int64>(max_cx) - min_cx + 1) * (static_cast<int64>(max_cy) - min_cy + 1);
+	if (cells > m_max_cells_per_volume) {
+		m_large.push_back(index);
+		return;
+	}
+
+	for (int32 cx = min_cx; cx <= max_cx; ++cx) {
+		for (int32 cy = min_cy; cy <= max_cy; ++cy) {
+			m_cells[CellKey(cx, cy)].push_back(index);
+		}
+	}
+}
+
+void LocalityGrid::Query(float x1, float y1, float x2, float y2, std::vector<uint32> &out)
+{
+	if (m_count == 0) {
+		return;
+	}
+
+	m_query_stamp++;
+	if (m_query_stamp == 0) {
+		std::fill(m_stamps.begin(), m_stamps.end(), 0);
+		m_query_stamp = 1;
+	}
+
+	for (auto index : m_large) {
+		Collect(index, out);
+	}
+
+	int32 cx1 = CellCoord(x1);
+	int32 cy1 = CellCoord(y1);
+	int32 cx2 = CellCoord(x2);
+	int32 cy2 = CellCoord(y2);
+
+	CollectCell(cx1, cy1, out);
+	if (cx1 != cx2 || cy1 != cy2) {
+		CollectCell(cx2, cy2, out);
+	}
+}
+
+void LocalityGrid::Query(float x, float y, std::vector<uint32> &out)
+{
+	Query(x, y, x, y, out);
+}
+
+int32 LocalityGrid::CellCoord(float v) const
+{
+	// keep absurd quest bounds from overflowing the cast
+	float c = std::floor(v / m_cell_size);
+	if (!(c > -1000000.0f)) {
+		return -1000000;
+	}
+	if (c > 1000000.0f) {
+		return 1000000;
+	}
+
+	return static_cast<int32>(c);
+}
+
+uint64 LocalityGrid::CellKey(int32 cx, int32 cy) const
+{
+	return (static_cast<uint64>(static_cast<uint32>(cx)) << 32) | static_cast<uint64>(static_cast<uint32>(cy));
+}
+
+void LocalityGrid::CollectCell(int32 cx, int32 cy, std::vector<uint32> &out)
+{
+	auto iter = m_cells.find(CellKey(cx, cy));
+	if (iter == m_cells.end()) {
+		return;
+	}
+
+	for (auto index : iter->second) {
+		Collect(index, out);
+	}
+}
+
+void LocalityGrid::Collect(uint32 index, std::vector<uint32> &out)
+{
+	if (m_stamps[index] == m_query_stamp) {
+		return;
+	}
+
+	m_stamps[index] = m_query_stamp;
+	out.push_back(index);
+}
@@ -0,0 +1,47 @@
+#ifndef LOCALITY_GRID_H
+#define LOCALITY_GRID_H
+
+#include <vector>
+#include <unordered_map>
+
+#include "../common/types.h"
+
+/*
+	Uniform 2D grid over axis aligned volumes (npc proximities, quest areas).
+
+	Volumes are inserted by an index into the caller's own storage and bucketed
+	into every cell their x/y footprint overlaps. Volumes that would cover too
+	many cells are kept on a separate list that every query returns, so a zone
+	wide area doesn't blow up the bucket count. Z is left to the caller's exact
+	bounds test.
+*/
+class LocalityGrid
+{
+public:
+	LocalityGrid(float cell_size = 256.0f, int max_cells_per_volume = 64);
+
+	void Clear();
+	void Insert(uint32 index, float min_x, float max_x, float min_y, float max_y);
+
+	// appends each volume that may contain either point to out, once
+	void Query(float x1, float y1, float x2, float y2, std::vector<uint32> &out);
+	void Query(float x, float y, std::vector<uint32> &out);
+
+	inline bool Empty() const { return m_count == 0; }
+
+private:
+	int32 CellCoord(float v) const;
+	uint64 CellKey(int32 cx, int32 cy) const;
+	void CollectCell(int32 cx, int32 cy, std::vector<uint32> &out);
+	void Collect(uint32 index, std::vector<uint32> &out);
+
+	float m_cell_size;
+	int m_max_cells_per_volume;
+	uint32 m_count;
+	uint32 m_query_stamp;
+	std::unordered_map<uint64, std::vector<uint32>> m_cells;
+	std::vector<uint32> m_large;
+	std::vector<uint32> m_stamps;
+};
+
+#endif
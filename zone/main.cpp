@@ -112,6 +112,7 @@ QuestParserCollection *parse = 0;
 EQEmuLogSys LogSys;
 const SPDat_Spell_Struct* spells;
 int32 SPDAT_RECORDS = -1;
+SPDat_Spell_Hot spells_hot;
 const ZoneConfig *Config;
 double frame_time = 0.0;
 
@@ -243,6 +244,7 @@ int main(int argc, char** argv) {
 	/* Register Log System and Settings */
 	LogSys.SetGMSayHandler(&Zone::GMSayHookCallBackProcess);
 	database.LoadLogSettings(LogSys.log_settings);
+	LogSys.SetFileLogOptions(Config->LogFileAsync, Config->LogFileQueueSize, Config->LogFileBlockWhenFull, Config->LogFileBinary);
 	LogSys.StartFileLogs();
 
 	/* Guilds */
@@ -311,6 +313,11 @@ int main(int argc, char** argv) {
 		LogError("Loading loot failed!");
 		return 1;
 	}
+	LogInfo("Loading npc types");
+	if (!database.LoadNPCTypes(hotfix_name)) {
+		LogError("Loading npc types failed!");
+		LogError("Failed. But ignoring error and going on, npc types will be loaded from the database..");
+	}
 	LogInfo("Loading skill caps");
 	if (!database.LoadSkillCaps(std::string(hotfix_name))) {
 		LogError("Loading skill caps failed!");
@@ -318,7 +325,7 @@ int main(int argc, char** argv) {
 	}
 
 	LogInfo("Loading spells");
-	if (!database.LoadSpells(hotfix_name, &SPDAT_RECORDS, &spells)) {
+	if (!database.LoadSpells(hotfix_name, &SPDAT_RECORDS, &spells, &spells_hot)) {
 		LogError("Loading spells failed!");
 		return 1;
 	}
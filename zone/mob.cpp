@@ -278,6 +278,7 @@ Mob::Mob(
 	rare_spawn        = false;
 	always_aggro      = in_always_aggro;
 
+	memset(buff_effect_counts, 0, sizeof(buff_effect_counts));
 	InitializeBuffSlots();
 
 	// clear the proc arrays
@@ -5328,6 +5329,9 @@ bool Mob::HasSpellEffect(int effectid)
 {
     int i;
 
+    if (IsEffectMaskable(effectid))
+        return HasBuffEffect(effectid);
+
     int buff_count = GetMaxTotalSlots();
     for(i = 0; i < buff_count; i++)
     {
@@ -395,6 +395,11 @@ public:
 	uint32 BuffCount();
 	bool FindType(uint16 type, bool bOffensive = false, uint16 threshold = 100);
 	int16 GetBuffSlotFromType(uint16 type);
+	// active effect counts, kept in step with buffs[] by AddBuff/BuffFadeBySlot.
+	// code that writes buffs[] directly (db loads, pet state) calls SyncBuffEffects after
+	void SetBuffEffectSlot(int slot, uint16 spell_id);
+	void SyncBuffEffects();
+	inline bool HasBuffEffect(int effect) const { return IsEffectMaskable(effect) && buff_effect_counts[effect] > 0; }
 	uint16 GetSpellIDFromSlot(uint8 slot);
 	int CountDispellableBuffs();
 	void CheckNumHitsRemaining(NumHit type, int32 buff_slot = -1, uint16 spell_id = SPELL_UNKNOWN);
@@ -1282,6 +1287,8 @@ protected:
 	uint32 scalerate;
 	Buffs_Struct *buffs;
 	uint32 current_buff_count;
+	uint8 buff_effect_counts[SPELL_EFFECT_MASK_BITS];
+	std::vector<uint16> buff_effect_slots; // spell counted into buff_effect_counts per slot
 	StatBonuses itembonuses;
 	StatBonuses spellbonuses;
 	StatBonuses aabonuses;
@@ -10,617 +10,570 @@
 
 #include <vector>
 #include <deque>
-#include <map>
+#include <unordered_map>
+#include <algorithm>
 #include <stdlib.h>
 
 extern double frame_time;
 extern Zone   *zone;
 
-class IMovementCommand {
-public:
-	IMovementCommand() = default;
-	virtual ~IMovementCommand() = default;
-	virtual bool Process(MobMovementManager *mob_movement_manager, Mob *mob) = 0;
-	virtual bool Started() const = 0;
+enum MovementCommandType : uint8 {
+	CommandRotateTo,
+	CommandMoveTo,
+	CommandFlyTo,
+	CommandSwimTo,
+	CommandTeleportTo,
+	CommandStopMoving,
+	CommandEvadeCombat
 };
 
-class RotateToCommand : public IMovementCommand {
-public:
-	RotateToCommand(double rotate_to, double dir, MobMovementMode mob_movement_mode)
-	{
-		m_rotate_to      = rotate_to;
-		m_rotate_to_dir  = dir;
-		m_rotate_to_mode = mob_movement_mode;
-		m_started        = false;
-	}
-
-	virtual ~RotateToCommand()
-	{
+struct RotateToData {
+	double          rotate_to;
+	double          rotate_to_dir;
+	MobMovementMode mode;
+	bool            started;
+};
 
-	}
+struct MoveToData {
+	double          distance_moved_since_correction;
+	double          move_to_x;
+	double          move_to_y;
+	double          move_to_z;
+	MobMovementMode mode;
+	bool            started;
+
+	double last_sent_time;
+	int    last_sent_speed;
+	double total_h_dist;
+	double total_v_dist;
+};
 
-	virtual bool Process(MobMovementManager *mob_movement_manager, Mob *mob)
-	{
-		if (!mob->IsAIControlled()) {
-			return true;
-		}
+struct TeleportToData {
+	double x;
+	double y;
+	double z;
+	double heading;
+};
 
-		auto rotate_to_speed = m_rotate_to_mode == MovementRunning ? 200.0 : 16.0; //todo: get this from mob
+/**
+ * Commands are stored by value in each entry's queue, type selects the live union member
+ */
+struct MovementCommand {
+	MovementCommandType type;
+	union {
+		RotateToData   rotate;
+		MoveToData     move;
+		TeleportToData teleport;
+	};
+};
 
-		auto from = FixHeading(mob->GetHeading());
-		auto to   = FixHeading(m_rotate_to);
-		auto diff = to - from;
+/**
+ * @param mob_movement_manager
+ * @param mob
+ * @param cmd
+ * @return
+ */
+static bool ProcessRotateTo(MobMovementManager *mob_movement_manager, Mob *mob, RotateToData &cmd)
+{
+	if (!mob->IsAIControlled()) {
+		return true;
+	}
 
-		while (diff < -256.0) {
-			diff += 512.0;
-		}
+	auto rotate_to_speed = cmd.mode == MovementRunning ? 200.0 : 16.0; //todo: get this from mob
 
-		while (diff > 256) {
-			diff -= 512.0;
-		}
+	auto from = FixHeading(mob->GetHeading());
+	auto to   = FixHeading(cmd.rotate_to);
+	auto diff = to - from;
 
-		auto dist = std::abs(diff);
-
-		if (!m_started) {
-			m_started = true;
-			mob->SetMoving(true);
-
-			if (dist > 15.0f && rotate_to_speed > 0.0 && rotate_to_speed <= 25.0) { //send basic rotation
-				mob_movement_manager->SendCommandToClients(
-					mob,
-					0.0,
-					0.0,
-					0.0,
-					m_rotate_to_dir * rotate_to_speed,
-					0,
-					ClientRangeClose
-				);
-			}
-		}
+	while (diff < -256.0) {
+		diff += 512.0;
+	}
 
-		auto td = rotate_to_speed * 19.0 * frame_time;
+	while (diff > 256) {
+		diff -= 512.0;
+	}
 
-		if (td >= dist) {
-			mob->SetHeading(to);
-			mob->SetMoving(false);
-			mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, 0, ClientRangeCloseMedium);
-			return true;
+	auto dist = std::abs(diff);
+
+	if (!cmd.started) {
+		cmd.started = true;
+		mob->SetMoving(true);
+
+		if (dist > 15.0f && rotate_to_speed > 0.0 && rotate_to_speed <= 25.0) { //send basic rotation
+			mob_movement_manager->SendCommandToClients(
+				mob,
+				0.0,
+				0.0,
+				0.0,
+				cmd.rotate_to_dir * rotate_to_speed,
+				0,
+				ClientRangeClose
+			);
 		}
-
-		from += td * m_rotate_to_dir;
-		mob->SetHeading(FixHeading(from));
-		return false;
 	}
 
-	virtual bool Started() const
-	{
-		return m_started;
-	}
+	auto td = rotate_to_speed * 19.0 * frame_time;
 
-private:
-	double          m_rotate_to;
-	double          m_rotate_to_dir;
-	MobMovementMode m_rotate_to_mode;
-	bool            m_started;
-};
+	if (td >= dist) {
+		mob->SetHeading(to);
+		mob->SetMoving(false);
+		mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, 0, ClientRangeCloseMedium);
+		return true;
+	}
 
-class MoveToCommand : public IMovementCommand {
-public:
-	MoveToCommand(float x, float y, float z, MobMovementMode mob_movement_mode)
-	{
-		m_distance_moved_since_correction = 0.0;
-		m_move_to_x                       = x;
-		m_move_to_y                       = y;
-		m_move_to_z                       = z;
-		m_move_to_mode                    = mob_movement_mode;
-		m_last_sent_time                  = 0.0;
-		m_last_sent_speed                 = 0;
-		m_started                         = false;
-		m_total_h_dist                    = 0.0;
-		m_total_v_dist                    = 0.0;
-	}
-
-	virtual ~MoveToCommand()
-	{
+	from += td * cmd.rotate_to_dir;
+	mob->SetHeading(FixHeading(from));
+	return false;
+}
 
+/**
+ * @param mob_movement_manager
+ * @param mob
+ * @param cmd
+ * @return
+ */
+static bool ProcessMoveTo(MobMovementManager *mob_movement_manager, Mob *mob, MoveToData &cmd)
+{
+	if (!mob->IsAIControlled()) {
+		return true;
 	}
 
-	/**
-	 * @param mob_movement_manager
-	 * @param mob
-	 * @return
-	 */
-	virtual bool Process(MobMovementManager *mob_movement_manager, Mob *mob)
-	{
-		if (!mob->IsAIControlled()) {
-			return true;
-		}
-
-		//Send a movement packet when you start moving		
-		double current_time  = static_cast<double>(Timer::GetCurrentTime()) / 1000.0;
-		int    current_speed = 0;
+	//Send a movement packet when you start moving		
+	double current_time  = static_cast<double>(Timer::GetCurrentTime()) / 1000.0;
+	int    current_speed = 0;
 
-		if (m_move_to_mode == MovementRunning) {
-			if (mob->IsFeared()) {
-				current_speed = mob->GetFearSpeed();
-			}
-			else {
-				current_speed = mob->GetRunspeed();
-			}
+	if (cmd.mode == MovementRunning) {
+		if (mob->IsFeared()) {
+			current_speed = mob->GetFearSpeed();
 		}
 		else {
-			current_speed = mob->GetWalkspeed();
-		}
-
-		if (!m_started) {
-			m_started = true;
-			//rotate to the point
-			mob->SetMoving(true);
-			mob->SetHeading(mob->CalculateHeadingToTarget(m_move_to_x, m_move_to_y));
-
-			m_last_sent_speed = current_speed;
-			m_last_sent_time  = current_time;
-			m_total_h_dist    = DistanceNoZ(mob->GetPosition(), glm::vec4(m_move_to_x, m_move_to_y, 0.0f, 0.0f));
-			m_total_v_dist    = m_move_to_z - mob->GetZ();
-			mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, current_speed, ClientRangeCloseMedium);
+			current_speed = mob->GetRunspeed();
 		}
+	}
+	else {
+		current_speed = mob->GetWalkspeed();
+	}
 
-		//When speed changes
-		if (current_speed != m_last_sent_speed) {
-			if (RuleB(Map, FixZWhenPathing)) {
-				mob->FixZ();
-			}
-
-			m_distance_moved_since_correction = 0.0;
-
-			m_last_sent_speed = current_speed;
-			m_last_sent_time  = current_time;
-			mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, current_speed, ClientRangeCloseMedium);
-		}
-
-		//If x seconds have passed without sending an update.
-		if (current_time - m_last_sent_time >= 5.0) {
-			if (RuleB(Map, FixZWhenPathing)) {
-				mob->FixZ();
-			}
-
-			m_distance_moved_since_correction = 0.0;
-
-			m_last_sent_speed = current_speed;
-			m_last_sent_time  = current_time;
-			mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, current_speed, ClientRangeCloseMedium);
-		}
+	if (!cmd.started) {
+		cmd.started = true;
+		//rotate to the point
+		mob->SetMoving(true);
+		mob->SetHeading(mob->CalculateHeadingToTarget(cmd.move_to_x, cmd.move_to_y));
+
+		cmd.last_sent_speed = current_speed;
+		cmd.last_sent_time  = current_time;
+		cmd.total_h_dist    = DistanceNoZ(mob->GetPosition(), glm::vec4(cmd.move_to_x, cmd.move_to_y, 0.0f, 0.0f));
+		cmd.total_v_dist    = cmd.move_to_z - mob->GetZ();
+		mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, current_speed, ClientRangeCloseMedium);
+	}
 
-		auto      &p  = mob->GetPosition();
-		glm::vec2 tar(m_move_to_x, m_move_to_y);
-		glm::vec2 pos(p.x, p.y);
-		double    len = glm::distance(pos, tar);
-		if (len == 0) {
-			return true;
+	//When speed changes
+	if (current_speed != cmd.last_sent_speed) {
+		if (RuleB(Map, FixZWhenPathing)) {
+			mob->FixZ();
 		}
 
-		mob->SetMoved(true);
-
-		glm::vec2 dir            = tar - pos;
-		glm::vec2 ndir           = glm::normalize(dir);
-		double    distance_moved = frame_time * current_speed * 0.4f * 1.45f;
-
-		if (distance_moved > len) {
-			if (mob->IsNPC()) {
-				entity_list.ProcessMove(mob->CastToNPC(), m_move_to_x, m_move_to_y, m_move_to_z);
-			}
-
-			mob->SetPosition(m_move_to_x, m_move_to_y, m_move_to_z);
-
-			if (RuleB(Map, FixZWhenPathing)) {
-				mob->FixZ();
-			}
-			return true;
-		}
-		else {
-			glm::vec2 npos = pos + (ndir * static_cast<float>(distance_moved));
-
-			len -= distance_moved;
-			double total_distance_traveled = m_total_h_dist - len;
-			double start_z                 = m_move_to_z - m_total_v_dist;
-			double z_at_pos                = start_z + (m_total_v_dist * (total_distance_traveled / m_total_h_dist));
-
-			if (mob->IsNPC()) {
-				entity_list.ProcessMove(mob->CastToNPC(), npos.x, npos.y, z_at_pos);
-			}
-
-			mob->SetPosition(npos.x, npos.y, z_at_pos);
+		cmd.distance_moved_since_correction = 0.0;
 
+		cmd.last_sent_speed = current_speed;
+		cmd.last_sent_time  = current_time;
+		mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, current_speed, ClientRangeCloseMedium);
+	}
 
-			if (RuleB(Map, FixZWhenPathing)) {
-				m_distance_moved_since_correction += distance_moved;
-				if (m_distance_moved_since_correction > RuleR(Map, DistanceCanTravelBeforeAdjustment)) {
-					m_distance_moved_since_correction = 0.0;
-					mob->FixZ();
-				}
-			}
+	//If x seconds have passed without sending an update.
+	if (current_time - cmd.last_sent_time >= 5.0) {
+		if (RuleB(Map, FixZWhenPathing)) {
+			mob->FixZ();
 		}
 
-		return false;
-	}
+		cmd.distance_moved_since_correction = 0.0;
 
-	virtual bool Started() const
-	{
-		return m_started;
+		cmd.last_sent_speed = current_speed;
+		cmd.last_sent_time  = current_time;
+		mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, current_speed, ClientRangeCloseMedium);
 	}
 
-protected:
-	double          m_distance_moved_since_correction;
-	double          m_move_to_x;
-	double          m_move_to_y;
-	double          m_move_to_z;
-	MobMovementMode m_move_to_mode;
-	bool            m_started;
-
-	double m_last_sent_time;
-	int    m_last_sent_speed;
-	double m_total_h_dist;
-	double m_total_v_dist;
-};
-
-class FlyToCommand : public IMovementCommand {
-public:
-	FlyToCommand(float x, float y, float z, MobMovementMode mob_movement_mode)
-	{
-		m_distance_moved_since_correction = 0.0;
-		m_move_to_x                       = x;
-		m_move_to_y                       = y;
-		m_move_to_z                       = z;
-		m_move_to_mode                    = mob_movement_mode;
-		m_last_sent_time                  = 0.0;
-		m_last_sent_speed                 = 0;
-		m_started                         = false;
-		m_total_h_dist                    = 0.0;
-		m_total_v_dist                    = 0.0;
-	}
-
-	virtual ~FlyToCommand()
-	{
-
+	auto      &p  = mob->GetPosition();
+	glm::vec2 tar(cmd.move_to_x, cmd.move_to_y);
+	glm::vec2 pos(p.x, p.y);
+	double    len = glm::distance(pos, tar);
+	if (len == 0) {
+		return true;
 	}
 
-	/**
-	 * @param mob_movement_manager
-	 * @param mob
-	 * @return
-	 */
-	virtual bool Process(MobMovementManager *mob_movement_manager, Mob *mob)
-	{
-		if (!mob->IsAIControlled()) {
-			return true;
-		}
+	mob->SetMoved(true);
 
-		//Send a movement packet when you start moving
-		double current_time  = static_cast<double>(Timer::GetCurrentTime()) / 1000.0;
-		int    current_speed = 0;
+	glm::vec2 dir            = tar - pos;
+	glm::vec2 ndir           = glm::normalize(dir);
+	double    distance_moved = frame_time * current_speed * 0.4f * 1.45f;
 
-		if (m_move_to_mode == MovementRunning) {
-			if (mob->IsFeared()) {
-				current_speed = mob->GetFearSpeed();
-			}
-			else {
-				current_speed = mob->GetRunspeed();
-			}
-		}
-		else {
-			current_speed = mob->GetWalkspeed();
+	if (distance_moved > len) {
+		if (mob->IsNPC()) {
+			entity_list.ProcessMove(mob->CastToNPC(), cmd.move_to_x, cmd.move_to_y, cmd.move_to_z);
 		}
 
-		if (!m_started) {
-			m_started = true;
-			//rotate to the point
-			mob->SetMoving(true);
-			mob->SetHeading(mob->CalculateHeadingToTarget(m_move_to_x, m_move_to_y));
-
-			m_last_sent_speed = current_speed;
-			m_last_sent_time  = current_time;
-			m_total_h_dist    = DistanceNoZ(mob->GetPosition(), glm::vec4(m_move_to_x, m_move_to_y, 0.0f, 0.0f));
-			m_total_v_dist    = m_move_to_z - mob->GetZ();
-			mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, current_speed, ClientRangeCloseMedium);
-		}
+		mob->SetPosition(cmd.move_to_x, cmd.move_to_y, cmd.move_to_z);
 
-		//When speed changes
-		if (current_speed != m_last_sent_speed) {
-			m_distance_moved_since_correction = 0.0;
-			m_last_sent_speed = current_speed;
-			m_last_sent_time  = current_time;
-			mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, current_speed, ClientRangeCloseMedium);
+		if (RuleB(Map, FixZWhenPathing)) {
+			mob->FixZ();
 		}
+		return true;
+	}
+	else {
+		glm::vec2 npos = pos + (ndir * static_cast<float>(distance_moved));
 
-		//If x seconds have passed without sending an update.
-		if (current_time - m_last_sent_time >= 0.5) {
-			m_distance_moved_since_correction = 0.0;
-			m_last_sent_speed = current_speed;
-			m_last_sent_time  = current_time;
-			mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, current_speed, ClientRangeCloseMedium);
-		}
+		len -= distance_moved;
+		double total_distance_traveled = cmd.total_h_dist - len;
+		double start_z                 = cmd.move_to_z - cmd.total_v_dist;
+		double z_at_pos                = start_z + (cmd.total_v_dist * (total_distance_traveled / cmd.total_h_dist));
 
-		auto      &p  = mob->GetPosition();
-		glm::vec2 tar(m_move_to_x, m_move_to_y);
-		glm::vec2 pos(p.x, p.y);
-		double    len = glm::distance(pos, tar);
-		if (len == 0) {
-			return true;
+		if (mob->IsNPC()) {
+			entity_list.ProcessMove(mob->CastToNPC(), npos.x, npos.y, z_at_pos);
 		}
 
-		mob->SetMoved(true);
+		mob->SetPosition(npos.x, npos.y, z_at_pos);
 
-		glm::vec2 dir            = tar - pos;
-		glm::vec2 ndir           = glm::normalize(dir);
-		double    distance_moved = frame_time * current_speed * 0.4f * 1.45f;
 
-		if (distance_moved > len) {
-			if (mob->IsNPC()) {
-				entity_list.ProcessMove(mob->CastToNPC(), m_move_to_x, m_move_to_y, m_move_to_z);
-			}
-
-			mob->SetPosition(m_move_to_x, m_move_to_y, m_move_to_z);
-
-			if (RuleB(Map, FixZWhenPathing)) {
+		if (RuleB(Map, FixZWhenPathing)) {
+			cmd.distance_moved_since_correction += distance_moved;
+			if (cmd.distance_moved_since_correction > RuleR(Map, DistanceCanTravelBeforeAdjustment)) {
+				cmd.distance_moved_since_correction = 0.0;
 				mob->FixZ();
 			}
-			return true;
 		}
-		else {
-			glm::vec2 npos = pos + (ndir * static_cast<float>(distance_moved));
+	}
 
-			len -= distance_moved;
-			double total_distance_traveled = m_total_h_dist - len;
-			double start_z                 = m_move_to_z - m_total_v_dist;
-			double z_at_pos                = start_z + (m_total_v_dist * (total_distance_traveled / m_total_h_dist));
+	return false;
+}
 
-			if (mob->IsNPC()) {
-				entity_list.ProcessMove(mob->CastToNPC(), npos.x, npos.y, z_at_pos);
-			}
+/**
+ * @param mob_movement_manager
+ * @param mob
+ * @param cmd
+ * @return
+ */
+static bool ProcessFlyTo(MobMovementManager *mob_movement_manager, Mob *mob, MoveToData &cmd)
+{
+	if (!mob->IsAIControlled()) {
+		return true;
+	}
 
-			mob->SetPosition(npos.x, npos.y, z_at_pos);
-		}
+	//Send a movement packet when you start moving
+	double current_time  = static_cast<double>(Timer::GetCurrentTime()) / 1000.0;
+	int    current_speed = 0;
 
-		return false;
+	if (cmd.mode == MovementRunning) {
+		if (mob->IsFeared()) {
+			current_speed = mob->GetFearSpeed();
+		}
+		else {
+			current_speed = mob->GetRunspeed();
+		}
 	}
-
-	virtual bool Started() const
-	{
-		return m_started;
+	else {
+		current_speed = mob->GetWalkspeed();
 	}
 
-protected:
-	double          m_distance_moved_since_correction;
-	double          m_move_to_x;
-	double          m_move_to_y;
-	double          m_move_to_z;
-	MobMovementMode m_move_to_mode;
-	bool            m_started;
+	if (!cmd.started) {
+		cmd.started = true;
+		//rotate to the point
+		mob->SetMoving(true);
+		mob->SetHeading(mob->CalculateHeadingToTarget(cmd.move_to_x, cmd.move_to_y));
+
+		cmd.last_sent_speed = current_speed;
+		cmd.last_sent_time  = current_time;
+		cmd.total_h_dist    = DistanceNoZ(mob->GetPosition(), glm::vec4(cmd.move_to_x, cmd.move_to_y, 0.0f, 0.0f));
+		cmd.total_v_dist    = cmd.move_to_z - mob->GetZ();
+		mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, current_speed, ClientRangeCloseMedium);
+	}
 
-	double m_last_sent_time;
-	int    m_last_sent_speed;
-	double m_total_h_dist;
-	double m_total_v_dist;
-};
+	//When speed changes
+	if (current_speed != cmd.last_sent_speed) {
+		cmd.distance_moved_since_correction = 0.0;
+		cmd.last_sent_speed = current_speed;
+		cmd.last_sent_time  = current_time;
+		mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, current_speed, ClientRangeCloseMedium);
+	}
 
-class SwimToCommand : public MoveToCommand {
-public:
-	SwimToCommand(float x, float y, float z, MobMovementMode mob_movement_mode) : MoveToCommand(x, y, z, mob_movement_mode)
-	{
+	//If x seconds have passed without sending an update.
+	if (current_time - cmd.last_sent_time >= 0.5) {
+		cmd.distance_moved_since_correction = 0.0;
+		cmd.last_sent_speed = current_speed;
+		cmd.last_sent_time  = current_time;
+		mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, current_speed, ClientRangeCloseMedium);
+	}
 
+	auto      &p  = mob->GetPosition();
+	glm::vec2 tar(cmd.move_to_x, cmd.move_to_y);
+	glm::vec2 pos(p.x, p.y);
+	double    len = glm::distance(pos, tar);
+	if (len == 0) {
+		return true;
 	}
 
-	virtual bool Process(MobMovementManager *mob_movement_manager, Mob *mob)
-	{
-		if (!mob->IsAIControlled()) {
-			return true;
-		}
+	mob->SetMoved(true);
 
-		//Send a movement packet when you start moving
-		double current_time  = static_cast<double>(Timer::GetCurrentTime()) / 1000.0;
-		int    current_speed = 0;
+	glm::vec2 dir            = tar - pos;
+	glm::vec2 ndir           = glm::normalize(dir);
+	double    distance_moved = frame_time * current_speed * 0.4f * 1.45f;
 
-		if (m_move_to_mode == MovementRunning) {
-			if (mob->IsFeared()) {
-				current_speed = mob->GetFearSpeed();
-			}
-			else {
-				current_speed = mob->GetRunspeed();
-			}
-		}
-		else {
-			current_speed = mob->GetWalkspeed();
+	if (distance_moved > len) {
+		if (mob->IsNPC()) {
+			entity_list.ProcessMove(mob->CastToNPC(), cmd.move_to_x, cmd.move_to_y, cmd.move_to_z);
 		}
 
-		if (!m_started) {
-			m_started = true;
-			//rotate to the point
-			mob->SetMoving(true);
-			mob->SetHeading(mob->CalculateHeadingToTarget(m_move_to_x, m_move_to_y));
-
-			m_last_sent_speed = current_speed;
-			m_last_sent_time  = current_time;
-			m_total_h_dist    = DistanceNoZ(mob->GetPosition(), glm::vec4(m_move_to_x, m_move_to_y, 0.0f, 0.0f));
-			m_total_v_dist    = m_move_to_z - mob->GetZ();
-			mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, current_speed, ClientRangeCloseMedium);
-		}
+		mob->SetPosition(cmd.move_to_x, cmd.move_to_y, cmd.move_to_z);
 
-		//When speed changes
-		if (current_speed != m_last_sent_speed) {
-			m_last_sent_speed = current_speed;
-			m_last_sent_time  = current_time;
-			mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, current_speed, ClientRangeCloseMedium);
+		if (RuleB(Map, FixZWhenPathing)) {
+			mob->FixZ();
 		}
+		return true;
+	}
+	else {
+		glm::vec2 npos = pos + (ndir * static_cast<float>(distance_moved));
 
-		//If x seconds have passed without sending an update.
-		if (current_time - m_last_sent_time >= 1.5) {
-			m_last_sent_speed = current_speed;
-			m_last_sent_time  = current_time;
-			mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, current_speed, ClientRangeCloseMedium);
-		}
+		len -= distance_moved;
+		double total_distance_traveled = cmd.total_h_dist - len;
+		double start_z                 = cmd.move_to_z - cmd.total_v_dist;
+		double z_at_pos                = start_z + (cmd.total_v_dist * (total_distance_traveled / cmd.total_h_dist));
 
-		auto      &p  = mob->GetPosition();
-		glm::vec2 tar(m_move_to_x, m_move_to_y);
-		glm::vec2 pos(p.x, p.y);
-		double    len = glm::distance(pos, tar);
-		if (len == 0) {
-			return true;
+		if (mob->IsNPC()) {
+			entity_list.ProcessMove(mob->CastToNPC(), npos.x, npos.y, z_at_pos);
 		}
 
-		mob->SetMoved(true);
+		mob->SetPosition(npos.x, npos.y, z_at_pos);
+	}
 
-		glm::vec2 dir            = tar - pos;
-		glm::vec2 ndir           = glm::normalize(dir);
-		double    distance_moved = frame_time * current_speed * 0.4f * 1.45f;
+	return false;
+}
 
-		if (distance_moved > len) {
-			if (mob->IsNPC()) {
-				entity_list.ProcessMove(mob->CastToNPC(), m_move_to_x, m_move_to_y, m_move_to_z);
-			}
+/**
+ * @param mob_movement_manager
+ * @param mob
+ * @param cmd
+ * @return
+ */
+static bool ProcessSwimTo(MobMovementManager *mob_movement_manager, Mob *mob, MoveToData &cmd)
+{
+	if (!mob->IsAIControlled()) {
+		return true;
+	}
+
+	//Send a movement packet when you start moving
+	double current_time  = static_cast<double>(Timer::GetCurrentTime()) / 1000.0;
+	int    current_speed = 0;
 
-			mob->SetPosition(m_move_to_x, m_move_to_y, m_move_to_z);
-			return true;
+	if (cmd.mode == MovementRunning) {
+		if (mob->IsFeared()) {
+			current_speed = mob->GetFearSpeed();
 		}
 		else {
-			glm::vec2 npos = pos + (ndir * static_cast<float>(distance_moved));
-
-			len -= distance_moved;
-			double total_distance_traveled = m_total_h_dist - len;
-			double start_z                 = m_move_to_z - m_total_v_dist;
-			double z_at_pos                = start_z + (m_total_v_dist * (total_distance_traveled / m_total_h_dist));
-
-			if (mob->IsNPC()) {
-				entity_list.ProcessMove(mob->CastToNPC(), npos.x, npos.y, z_at_pos);
-			}
-
-			mob->SetPosition(npos.x, npos.y, z_at_pos);
+			current_speed = mob->GetRunspeed();
 		}
+	}
+	else {
+		current_speed = mob->GetWalkspeed();
+	}
 
-		return false;
+	if (!cmd.started) {
+		cmd.started = true;
+		//rotate to the point
+		mob->SetMoving(true);
+		mob->SetHeading(mob->CalculateHeadingToTarget(cmd.move_to_x, cmd.move_to_y));
+
+		cmd.last_sent_speed = current_speed;
+		cmd.last_sent_time  = current_time;
+		cmd.total_h_dist    = DistanceNoZ(mob->GetPosition(), glm::vec4(cmd.move_to_x, cmd.move_to_y, 0.0f, 0.0f));
+		cmd.total_v_dist    = cmd.move_to_z - mob->GetZ();
+		mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, current_speed, ClientRangeCloseMedium);
 	}
-};
 
-class TeleportToCommand : public IMovementCommand {
-public:
-	TeleportToCommand(float x, float y, float z, float heading)
-	{
-		m_teleport_to_x       = x;
-		m_teleport_to_y       = y;
-		m_teleport_to_z       = z;
-		m_teleport_to_heading = heading;
+	//When speed changes
+	if (current_speed != cmd.last_sent_speed) {
+		cmd.last_sent_speed = current_speed;
+		cmd.last_sent_time  = current_time;
+		mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, current_speed, ClientRangeCloseMedium);
 	}
 
-	virtual ~TeleportToCommand()
-	{
+	//If x seconds have passed without sending an update.
+	if (current_time - cmd.last_sent_time >= 1.5) {
+		cmd.last_sent_speed = current_speed;
+		cmd.last_sent_time  = current_time;
+		mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, current_speed, ClientRangeCloseMedium);
+	}
 
+	auto      &p  = mob->GetPosition();
+	glm::vec2 tar(cmd.move_to_x, cmd.move_to_y);
+	glm::vec2 pos(p.x, p.y);
+	double    len = glm::distance(pos, tar);
+	if (len == 0) {
+		return true;
 	}
 
-	virtual bool Process(MobMovementManager *mob_movement_manager, Mob *mob)
-	{
-		if (!mob->IsAIControlled()) {
-			return true;
-		}
+	mob->SetMoved(true);
+
+	glm::vec2 dir            = tar - pos;
+	glm::vec2 ndir           = glm::normalize(dir);
+	double    distance_moved = frame_time * current_speed * 0.4f * 1.45f;
 
+	if (distance_moved > len) {
 		if (mob->IsNPC()) {
-			entity_list.ProcessMove(mob->CastToNPC(), m_teleport_to_x, m_teleport_to_y, m_teleport_to_z);
+			entity_list.ProcessMove(mob->CastToNPC(), cmd.move_to_x, cmd.move_to_y, cmd.move_to_z);
 		}
 
-		mob->SetPosition(m_teleport_to_x, m_teleport_to_y, m_teleport_to_z);
-		mob->SetHeading(mob_movement_manager->FixHeading(m_teleport_to_heading));
-		mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, 0, ClientRangeAny);
-
+		mob->SetPosition(cmd.move_to_x, cmd.move_to_y, cmd.move_to_z);
 		return true;
 	}
+	else {
+		glm::vec2 npos = pos + (ndir * static_cast<float>(distance_moved));
 
-	virtual bool Started() const
-	{
-		return false;
-	}
-
-private:
+		len -= distance_moved;
+		double total_distance_traveled = cmd.total_h_dist - len;
+		double start_z                 = cmd.move_to_z - cmd.total_v_dist;
+		double z_at_pos                = start_z + (cmd.total_v_dist * (total_distance_traveled / cmd.total_h_dist));
 
-	double m_teleport_to_x;
-	double m_teleport_to_y;
-	double m_teleport_to_z;
-	double m_teleport_to_heading;
-};
+		if (mob->IsNPC()) {
+			entity_list.ProcessMove(mob->CastToNPC(), npos.x, npos.y, z_at_pos);
+		}
 
-class StopMovingCommand : public IMovementCommand {
-public:
-	StopMovingCommand()
-	{
+		mob->SetPosition(npos.x, npos.y, z_at_pos);
 	}
 
-	virtual ~StopMovingCommand()
-	{
+	return false;
+}
 
+/**
+ * @param mob_movement_manager
+ * @param mob
+ * @param cmd
+ * @return
+ */
+static bool ProcessTeleportTo(MobMovementManager *mob_movement_manager, Mob *mob, TeleportToData &cmd)
+{
+	if (!mob->IsAIControlled()) {
+		return true;
 	}
 
-	virtual bool Process(MobMovementManager *mob_movement_manager, Mob *mob)
-	{
-		if (!mob->IsAIControlled()) {
-			return true;
-		}
+	if (mob->IsNPC()) {
+		entity_list.ProcessMove(mob->CastToNPC(), cmd.x, cmd.y, cmd.z);
+	}
 
-		if (mob->IsMoving()) {
-			mob->SetMoving(false);
-			if (RuleB(Map, FixZWhenPathing)) {
-				mob->FixZ();
-			}
-			mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, 0, ClientRangeCloseMedium);
-		}
+	mob->SetPosition(cmd.x, cmd.y, cmd.z);
+	mob->SetHeading(mob_movement_manager->FixHeading(cmd.heading));
+	mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, 0, ClientRangeAny);
+
+	return true;
+}
+
+/**
+ * @param mob_movement_manager
+ * @param mob
+ * @return
+ */
+static bool ProcessStopMoving(MobMovementManager *mob_movement_manager, Mob *mob)
+{
+	if (!mob->IsAIControlled()) {
 		return true;
 	}
 
-	virtual bool Started() const
-	{
-		return false;
+	if (mob->IsMoving()) {
+		mob->SetMoving(false);
+		if (RuleB(Map, FixZWhenPathing)) {
+			mob->FixZ();
+		}
+		mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, 0, ClientRangeCloseMedium);
 	}
-};
+	return true;
+}
 
-class EvadeCombatCommand : public IMovementCommand {
-public:
-	EvadeCombatCommand()
-	{
+/**
+ * @param mob_movement_manager
+ * @param mob
+ * @return
+ */
+static bool ProcessEvadeCombat(MobMovementManager *mob_movement_manager, Mob *mob)
+{
+	if (!mob->IsAIControlled()) {
+		return true;
 	}
 
-	virtual ~EvadeCombatCommand()
-	{
-
+	if (mob->IsMoving()) {
+		mob->SetMoving(false);
+		mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, 0, ClientRangeCloseMedium);
 	}
 
-	virtual bool Process(MobMovementManager *mob_movement_manager, Mob *mob)
-	{
-		if (!mob->IsAIControlled()) {
-			return true;
-		}
+	mob->BuffFadeAll();
+	mob->WipeHateList();
+	mob->Heal();
 
-		if (mob->IsMoving()) {
-			mob->SetMoving(false);
-			mob_movement_manager->SendCommandToClients(mob, 0.0, 0.0, 0.0, 0.0, 0, ClientRangeCloseMedium);
-		}
+	return true;
+}
 
-		mob->BuffFadeAll();
-		mob->WipeHateList();
-		mob->Heal();
+/**
+ * @param type
+ * @param x
+ * @param y
+ * @param z
+ * @param mob_movement_mode
+ * @return
+ */
+static MovementCommand MakeMoveCommand(MovementCommandType type, float x, float y, float z, MobMovementMode mob_movement_mode)
+{
+	MovementCommand command;
+	command.type = type;
+
+	auto &cmd = command.move;
+	cmd.distance_moved_since_correction = 0.0;
+	cmd.move_to_x                       = x;
+	cmd.move_to_y                       = y;
+	cmd.move_to_z                       = z;
+	cmd.mode                            = mob_movement_mode;
+	cmd.last_sent_time                  = 0.0;
+	cmd.last_sent_speed                 = 0;
+	cmd.started                         = false;
+	cmd.total_h_dist                    = 0.0;
+	cmd.total_v_dist                    = 0.0;
+	return command;
+}
 
-		return true;
+/**
+ * @param mob_movement_manager
+ * @param mob
+ * @param command
+ * @return true when the command has finished
+ */
+static bool ProcessCommand(MobMovementManager *mob_movement_manager, Mob *mob, MovementCommand &command)
+{
+	switch (command.type) {
+		case CommandRotateTo:
+			return ProcessRotateTo(mob_movement_manager, mob, command.rotate);
+		case CommandMoveTo:
+			return ProcessMoveTo(mob_movement_manager, mob, command.move);
+		case CommandFlyTo:
+			return ProcessFlyTo(mob_movement_manager, mob, command.move);
+		case CommandSwimTo:
+			return ProcessSwimTo(mob_movement_manager, mob, command.move);
+		case CommandTeleportTo:
+			return ProcessTeleportTo(mob_movement_manager, mob, command.teleport);
+		case CommandStopMoving:
+			return ProcessStopMoving(mob_movement_manager, mob);
+		case CommandEvadeCombat:
+			return ProcessEvadeCombat(mob_movement_manager, mob);
 	}
 
-	virtual bool Started() const
-	{
-		return false;
-	}
-};
+	return true;
+}
 
 struct MovementStats {
 	MovementStats()
 	{
-		LastResetTime     = static_cast<double>(Timer::GetCurrentTime()) / 1000.0;
-		TotalSent         = 0ULL;
-		TotalSentMovement = 0ULL;
-		TotalSentPosition = 0ULL;
-		TotalSentHeading  = 0ULL;
+		LastResetTime      = static_cast<double>(Timer::GetCurrentTime()) / 1000.0;
+		TotalSent          = 0ULL;
+		TotalSentMovement  = 0ULL;
+		TotalSentPosition  = 0ULL;
+		TotalSentHeading   = 0ULL;
+		TotalSkippedRate   = 0ULL;
+		TotalSkippedBudget = 0ULL;
 	}
 
 	double   LastResetTime;
@@ -628,6 +581,49 @@ struct MovementStats {
 	uint64_t TotalSentMovement;
 	uint64_t TotalSentPosition;
 	uint64_t TotalSentHeading;
+	uint64_t TotalSkippedRate;
+	uint64_t TotalSkippedBudget;
+};
+
+enum InterestTier : int {
+	InterestTierHigh = 0,
+	InterestTierMedium,
+	InterestTierLow
+};
+
+//drift from the last update sent to a client that counts as a new state rather than a repeat
+const float InterestHeadingEpsilon  = 1.0f;
+const float InterestPositionEpsilon = 1.0f;
+
+struct InterestState {
+	InterestState()
+	{
+		last_sent_time    = 0;
+		last_anim         = 0;
+		last_heading_sign = 0;
+		last_heading      = 0.0f;
+	}
+
+	uint32    last_sent_time;
+	int       last_anim;
+	int       last_heading_sign;
+	float     last_heading;
+	glm::vec3 last_position;
+};
+
+/**
+ * Per client bookkeeping for tiered movement updates, keyed by mob entity id
+ */
+struct ClientInterest {
+	ClientInterest()
+	{
+		tick           = 0;
+		sent_this_tick = 0;
+	}
+
+	uint64                                    tick;
+	int                                       sent_this_tick;
+	std::unordered_map<uint16, InterestState> mobs;
 };
 
 struct NavigateTo {
@@ -647,9 +643,62 @@ struct NavigateTo {
 	double last_set_time;
 };
 
+struct PathRequest {
+	PathRequest()
+	{
+		id             = 0;
+		requested_time = 0;
+		mode           = MovementRunning;
+		fallback_taken = false;
+	}
+
+	uint32          id;
+	uint32          requested_time;
+	MobMovementMode mode;
+	bool            fallback_taken;
+};
+
+/**
+ * Commands are consumed from CommandHead onward; the vector keeps its capacity
+ * when drained so steady state movement does not allocate
+ */
 struct MobMovementEntry {
-	std::deque<std::unique_ptr<IMovementCommand>> Commands;
-	NavigateTo                                    NavTo;
+	MobMovementEntry()
+	{
+		CommandHead       = 0;
+		CommandGeneration = 0;
+	}
+
+	bool HasCommands() const { return CommandHead < Commands.size(); }
+	size_t CommandCount() const { return Commands.size() - CommandHead; }
+	MovementCommand &FrontCommand() { return Commands[CommandHead]; }
+
+	void PushCommand(const MovementCommand &command)
+	{
+		Commands.push_back(command);
+	}
+
+	void PopCommand()
+	{
+		CommandHead++;
+		if (CommandHead >= Commands.size()) {
+			Commands.clear();
+			CommandHead = 0;
+		}
+	}
+
+	void ClearCommands()
+	{
+		Commands.clear();
+		CommandHead = 0;
+		CommandGeneration++;
+	}
+
+	std::vector<MovementCommand> Commands;
+	size_t                       CommandHead;
+	uint32                       CommandGeneration;
+	NavigateTo                   NavTo;
+	PathRequest                  PendingPath;
 };
 
 void AdjustRoute(std::list<IPathfinder::IPathNode> &nodes, Mob *who)
@@ -670,15 +719,38 @@ void AdjustRoute(std::list<IPathfinder::IPathNode> &nodes, Mob *who)
 	}
 }
 
+/**
+ * Entries live in fixed slots so a mob keeps the same index for its lifetime; Mobs[i] is
+ * null for free slots. std::deque never moves existing elements on growth, so an entry
+ * stays valid even if a mob is added while another mob's commands are running
+ */
 struct MobMovementManager::Implementation {
-	std::map<Mob *, MobMovementEntry> Entries;
-	std::vector<Client *>             Clients;
-	MovementStats                     Stats;
+	MobMovementEntry *FindEntry(Mob *mob)
+	{
+		auto iter = EntryIndex.find(mob);
+		if (iter == EntryIndex.end()) {
+			return nullptr;
+		}
+
+		return &Entries[iter->second];
+	}
+
+	std::vector<Mob *>                 Mobs;
+	std::deque<MobMovementEntry>       Entries;
+	std::vector<size_t>                FreeSlots;
+	std::unordered_map<Mob *, size_t> EntryIndex;
+	std::vector<Client *>              Clients;
+	std::unordered_map<Client *, ClientInterest> Interest;
+	MovementStats                      Stats;
+	uint32                             LastPathRequestId;
+	uint64                             Tick;
 };
 
 MobMovementManager::MobMovementManager()
 {
 	_impl.reset(new Implementation());
+	_impl->LastPathRequestId = 0;
+	_impl->Tick              = 0;
 }
 
 MobMovementManager::~MobMovementManager()
@@ -687,19 +759,42 @@ MobMovementManager::~MobMovementManager()
 
 void MobMovementManager::Process()
 {
-	for (auto &iter : _impl->Entries) {
-		auto &ent      = iter.second;
-		auto &commands = ent.Commands;
+	auto &mobs    = _impl->Mobs;
+	auto &entries = _impl->Entries;
 
-		while (true != commands.empty()) {
-			auto &cmd = commands.front();
-			auto r    = cmd->Process(this, iter.first);
+	_impl->Tick++;
+
+	for (size_t i = 0; i < mobs.size(); ++i) {
+		auto mob = mobs[i];
+		if (mob == nullptr) {
+			continue;
+		}
+
+		auto &ent = entries[i];
+		if (!ent.HasCommands()) {
+			if (ent.PendingPath.id == 0) {
+				continue;
+			}
+
+			ProcessPathFallback(mob, ent);
+		}
+
+		while (ent.HasCommands()) {
+			//run a copy, commands can reach back into the manager and replace this queue
+			auto cmd        = ent.FrontCommand();
+			auto generation = ent.CommandGeneration;
+			auto r          = ProcessCommand(this, mob, cmd);
+
+			if (mobs[i] != mob || ent.CommandGeneration != generation) {
+				break;
+			}
 
 			if (true != r) {
+				ent.FrontCommand() = cmd;
 				break;
 			}
 
-			commands.pop_front();
+			ent.PopCommand();
 		}
 	}
 }
@@ -709,7 +804,29 @@ void MobMovementManager::Process()
  */
 void MobMovementManager::AddMob(Mob *mob)
 {
-	_impl->Entries.insert(std::make_pair(mob, MobMovementEntry()));
+	if (_impl->EntryIndex.count(mob) > 0) {
+		return;
+	}
+
+	size_t slot;
+	if (!_impl->FreeSlots.empty()) {
+		slot = _impl->FreeSlots.back();
+		_impl->FreeSlots.pop_back();
+
+		//reuse the slot in place so the command queue keeps its capacity
+		auto &ent = _impl->Entries[slot];
+		ent.ClearCommands();
+		ent.NavTo       = ::NavigateTo();
+		ent.PendingPath = PathRequest();
+		_impl->Mobs[slot] = mob;
+	}
+	else {
+		slot = _impl->Entries.size();
+		_impl->Entries.push_back(MobMovementEntry());
+		_impl->Mobs.push_back(mob);
+	}
+
+	_impl->EntryIndex[mob] = slot;
 }
 
 /**
@@ -717,7 +834,22 @@ void MobMovementManager::AddMob(Mob *mob)
  */
 void MobMovementManager::RemoveMob(Mob *mob)
 {
-	_impl->Entries.erase(mob);
+	auto iter = _impl->EntryIndex.find(mob);
+	if (iter == _impl->EntryIndex.end()) {
+		return;
+	}
+
+	auto slot = iter->second;
+	_impl->EntryIndex.erase(iter);
+
+	_impl->Entries[slot].ClearCommands();
+	_impl->Entries[slot].PendingPath.id = 0;
+	_impl->Mobs[slot] = nullptr;
+	_impl->FreeSlots.push_back(slot);
+
+	for (auto &interest : _impl->Interest) {
+		interest.second.mobs.erase(mob->GetID());
+	}
 }
 
 /**
@@ -737,6 +869,7 @@ void MobMovementManager::RemoveClient(Client *client)
 	while (iter != _impl->Clients.end()) {
 		if (client == *iter) {
 			_impl->Clients.erase(iter);
+			_impl->Interest.erase(client);
 			return;
 		}
 
@@ -751,14 +884,13 @@ void MobMovementManager::RemoveClient(Client *client)
  */
 void MobMovementManager::RotateTo(Mob *who, float to, MobMovementMode mob_movement_mode)
 {
-	auto iter = _impl->Entries.find(who);
-	auto &ent = (*iter);
+	auto &ent = *_impl->FindEntry(who);
 
-	if (true != ent.second.Commands.empty()) {
+	if (ent.HasCommands()) {
 		return;
 	}
 
-	PushRotateTo(ent.second, who, to, mob_movement_mode);
+	PushRotateTo(ent, who, to, mob_movement_mode);
 }
 
 /**
@@ -770,12 +902,12 @@ void MobMovementManager::RotateTo(Mob *who, float to, MobMovementMode mob_moveme
  */
 void MobMovementManager::Teleport(Mob *who, float x, float y, float z, float heading)
 {
-	auto iter = _impl->Entries.find(who);
-	auto &ent = (*iter);
+	auto &ent = *_impl->FindEntry(who);
 
-	ent.second.Commands.clear();
+	ent.ClearCommands();
+	ent.PendingPath.id = 0;
 
-	PushTeleportTo(ent.second, x, y, z, heading);
+	PushTeleportTo(ent, x, y, z, heading);
 }
 
 /**
@@ -791,9 +923,8 @@ void MobMovementManager::NavigateTo(Mob *who, float x, float y, float z, MobMove
 		return;
 	}
 
-	auto iter = _impl->Entries.find(who);
-	auto &ent = (*iter);
-	auto &nav = ent.second.NavTo;
+	auto &ent = *_impl->FindEntry(who);
+	auto &nav = ent.NavTo;
 
 	double current_time = static_cast<double>(Timer::GetCurrentTime()) / 1000.0;
 	if ((current_time - nav.last_set_time) > 0.5) {
@@ -807,9 +938,12 @@ void MobMovementManager::NavigateTo(Mob *who, float x, float y, float z, MobMove
 		);
 		auto heading_match = IsHeadingEqual(0.0, nav.navigate_to_heading);
 
-		if (false == within || false == heading_match || ent.second.Commands.size() == 0) {
-			ent.second.Commands.clear();
+		//A path to this spot is still being calculated, keep doing what we are doing until it arrives
+		if (within && heading_match && ent.PendingPath.id != 0) {
+			return;
+		}
 
+		if (false == within || false == heading_match || ent.CommandCount() == 0) {
 			//Path is no longer valid, calculate a new path
 			UpdatePath(who, x, y, z, mode);
 			nav.navigate_to_x       = x;
@@ -826,27 +960,28 @@ void MobMovementManager::NavigateTo(Mob *who, float x, float y, float z, MobMove
  */
 void MobMovementManager::StopNavigation(Mob *who)
 {
-	auto iter = _impl->Entries.find(who);
-	auto &ent = (*iter);
-	auto &nav = ent.second.NavTo;
+	auto &ent = *_impl->FindEntry(who);
+	auto &nav = ent.NavTo;
 
 	nav.navigate_to_x       = 0.0;
 	nav.navigate_to_y       = 0.0;
 	nav.navigate_to_z       = 0.0;
 	nav.navigate_to_heading = 0.0;
 
-	if (true == ent.second.Commands.empty()) {
-		PushStopMoving(ent.second);
+	ent.PendingPath.id = 0;
+
+	if (!ent.HasCommands()) {
+		PushStopMoving(ent);
 		return;
 	}
 
 	if (!who->IsMoving()) {
-		ent.second.Commands.clear();
+		ent.ClearCommands();
 		return;
 	}
 
-	ent.second.Commands.clear();
-	PushStopMoving(ent.second);
+	ent.ClearCommands();
+	PushStopMoving(ent);
 }
 
 /**
@@ -906,8 +1041,9 @@ void MobMovementManager::SendCommandToClients(
 		}
 	}
 	else {
-		float short_range = RuleR(Pathing, ShortMovementUpdateRange);
-		float long_range  = zone->GetNpcPositionUpdateDistance();
+		float short_range         = RuleR(Pathing, ShortMovementUpdateRange);
+		float long_range          = zone->GetNpcPositionUpdateDistance();
+		bool  interest_management = RuleB(Pathing, TieredMovementUpdates);
 
 		for (auto &c : _impl->Clients) {
 			if (single_client && c != single_client) {
@@ -939,6 +1075,10 @@ void MobMovementManager::SendCommandToClients(
 				}
 			}
 
+			if (match && interest_management && !single_client) {
+				match = CheckClientInterest(mob, c, distance, anim, delta_heading);
+			}
+
 			if (match) {
 				_impl->Stats.TotalSent++;
 
@@ -958,6 +1098,94 @@ void MobMovementManager::SendCommandToClients(
 	}
 }
 
+/**
+ * Decides whether a ranged movement update for mob is worth sending to client when tiered
+ * updates are on. Changes in animation, turn direction or heading, and a stopped mob showing
+ * up somewhere new, always go out; repeats of the last update are held back by an interval that grows with distance and shrinks when the
+ * client is engaged with or targeting the mob, then capped by a per client per tick budget
+ *
+ * @param mob
+ * @param client
+ * @param distance
+ * @param anim
+ * @param delta_heading
+ * @return
+ */
+bool MobMovementManager::CheckClientInterest(Mob *mob, Client *client, float distance, int anim, float delta_heading)
+{
+	auto &interest = _impl->Interest[client];
+	if (interest.tick != _impl->Tick) {
+		interest.tick           = _impl->Tick;
+		interest.sent_this_tick = 0;
+	}
+
+	auto &state        = interest.mobs[mob->GetID()];
+	int  heading_sign  = delta_heading > 0.0f ? 1 : (delta_heading < 0.0f ? -1 : 0);
+	auto current_time  = Timer::GetCurrentTime();
+	auto position      = glm::vec3(mob->GetX(), mob->GetY(), mob->GetZ());
+	bool state_changed = state.last_sent_time == 0 || state.last_anim != anim || state.last_heading_sign != heading_sign;
+
+	//a new waypoint turns the mob, the client only extrapolates along the heading it was last sent
+	if (!state_changed) {
+		auto heading_diff = std::abs(mob->GetHeading() - state.last_heading);
+		if (heading_diff > 256.0f) {
+			heading_diff = 512.0f - heading_diff;
+		}
+
+		state_changed = heading_diff > InterestHeadingEpsilon;
+	}
+
+	//moving mobs are extrapolated client side, a stopped one should not drift
+	if (!state_changed && anim == 0 && DistanceSquared(position, state.last_position) > InterestPositionEpsilon * InterestPositionEpsilon) {
+		state_changed = true;
+	}
+
+	if (!state_changed) {
+		auto tier = InterestTierLow;
+		if (client->GetTarget() == mob || mob->GetTarget() == client) {
+			tier = InterestTierHigh;
+		}
+		else if (mob->IsEngaged() && mob->CheckAggro(client)) {
+			tier = InterestTierHigh;
+		}
+		else if (distance < RuleR(Pathing, ShortMovementUpdateRange)) {
+			tier = InterestTierMedium;
+		}
+
+		//mobs the client cannot see drop to the slowest tier
+		if (tier != InterestTierHigh && mob->IsInvisible(client)) {
+			tier = InterestTierLow;
+		}
+
+		uint32 interval = 0;
+		if (tier == InterestTierMedium) {
+			interval = static_cast<uint32>(RuleI(Pathing, TieredUpdateMediumInterval));
+		}
+		else if (tier == InterestTierLow) {
+			interval = static_cast<uint32>(RuleI(Pathing, TieredUpdateLowInterval));
+		}
+
+		if (current_time - state.last_sent_time < interval) {
+			_impl->Stats.TotalSkippedRate++;
+			return false;
+		}
+
+		auto budget = RuleI(Pathing, TieredUpdateClientBudget);
+		if (tier != InterestTierHigh && budget > 0 && interest.sent_this_tick >= budget) {
+			_impl->Stats.TotalSkippedBudget++;
+			return false;
+		}
+	}
+
+	interest.sent_this_tick++;
+	state.last_sent_time    = current_time;
+	state.last_anim         = anim;
+	state.last_heading_sign = heading_sign;
+	state.last_heading      = mob->GetHeading();
+	state.last_position     = position;
+	return true;
+}
+
 /**
  * @param in
  * @return
@@ -1009,6 +1237,18 @@ void MobMovementManager::DumpStats(Client *client)
 		_impl->Stats.TotalSentPosition,
 		static_cast<double>(_impl->Stats.TotalSentPosition) / total_time
 	);
+	client->Message(
+		Chat::System,
+		"Total Skipped (Rate): %u (%.2f / sec)",
+		_impl->Stats.TotalSkippedRate,
+		static_cast<double>(_impl->Stats.TotalSkippedRate) / total_time
+	);
+	client->Message(
+		Chat::System,
+		"Total Skipped (Budget): %u (%.2f / sec)",
+		_impl->Stats.TotalSkippedBudget,
+		static_cast<double>(_impl->Stats.TotalSkippedBudget) / total_time
+	);
 }
 
 void MobMovementManager::ClearStats()
@@ -1017,7 +1257,9 @@ void MobMovementManager::ClearStats()
 	_impl->Stats.TotalSent         = 0;
 	_impl->Stats.TotalSentHeading  = 0;
 	_impl->Stats.TotalSentMovement = 0;
-	_impl->Stats.TotalSentPosition = 0;
+	_impl->Stats.TotalSentPosition  = 0;
+	_impl->Stats.TotalSkippedRate   = 0;
+	_impl->Stats.TotalSkippedBudget = 0;
 }
 
 /**
@@ -1064,32 +1306,40 @@ void MobMovementManager::UpdatePath(Mob *who, float x, float y, float z, MobMove
 	Mob *target=who->GetTarget();
 
 	if (!zone->HasMap() || !zone->HasWaterMap()) {
-		auto iter = _impl->Entries.find(who);
-		auto &ent = (*iter);
+		auto &ent = *_impl->FindEntry(who);
 
-		PushMoveTo(ent.second, x, y, z, mob_movement_mode);
-		PushStopMoving(ent.second);
+		ent.ClearCommands();
+		ent.PendingPath.id = 0;
+		PushMoveTo(ent, x, y, z, mob_movement_mode);
+		PushStopMoving(ent);
 		return;
 	}
 
+	// If we can fly, and we have a target and we have LoS, simply fly to them.
+	// if we ever lose LoS we go back to mesh run mode.
+	bool fly_to_target = !who->IsBoat() && !who->IsUnderwaterOnly() && target &&
+		who->GetFlyMode() == GravityBehavior::Flying && who->CheckLosFN(x, y, z, target->GetSize());
+
+	// Ground paths are calculated async and replace the current commands when they arrive
+	if (!who->IsBoat() && !who->IsUnderwaterOnly() && !fly_to_target) {
+		UpdatePathGround(who, x, y, z, mob_movement_mode);
+		return;
+	}
+
+	auto &ent = *_impl->FindEntry(who);
+
+	ent.ClearCommands();
+	ent.PendingPath.id = 0;
+
 	if (who->IsBoat()) {
 		UpdatePathBoat(who, x, y, z, mob_movement_mode);
 	}
 	else if (who->IsUnderwaterOnly()) {
 		UpdatePathUnderwater(who, x, y, z, mob_movement_mode);
 	}
-	// If we can fly, and we have a target and we have LoS, simply fly to them.
-	// if we ever lose LoS we go back to mesh run mode.
-	else if (target && who->GetFlyMode() == GravityBehavior::Flying &&
-				who->CheckLosFN(x,y,z,target->GetSize())) {
-		auto iter = _impl->Entries.find(who);
-		auto &ent = (*iter);
-
-		PushFlyTo(ent.second, x, y, z, mob_movement_mode);
-		PushStopMoving(ent.second);
-		}
 	else {
-		UpdatePathGround(who, x, y, z, mob_movement_mode);
+		PushFlyTo(ent, x, y, z, mob_movement_mode);
+		PushStopMoving(ent);
 	}
 }
 
@@ -1108,19 +1358,53 @@ void MobMovementManager::UpdatePathGround(Mob *who, float x, float y, float z, M
 	opts.offset      = who->GetZOffset();
 	opts.flags       = PathingNotDisabled ^ PathingZoneLine;
 
+	auto &ent = *_impl->FindEntry(who);
+
+	_impl->LastPathRequestId++;
+	if (_impl->LastPathRequestId == 0) {
+		_impl->LastPathRequestId = 1;
+	}
+
+	auto request_id = _impl->LastPathRequestId;
+	auto &request   = ent.PendingPath;
+	request.id             = request_id;
+	request.requested_time = Timer::GetCurrentTime();
+	request.mode           = mode;
+	request.fallback_taken = false;
+
 	//This is probably pointless since the nav mesh tool currently sets zonelines to disabled anyway
-	auto partial = false;
-	auto stuck   = false;
-	auto route   = zone->pathing->FindPath(
+	zone->pathing->FindPathAsync(
 		glm::vec3(who->GetX(), who->GetY(), who->GetZ()),
 		glm::vec3(x, y, z),
-		partial,
-		stuck,
-		opts
+		opts,
+		[this, who, request_id, x, y, z, mode](const IPathfinder::IPath &route, bool partial, bool stuck) {
+			//the mob may have been removed or given new orders while the path was calculated
+			auto entry = _impl->FindEntry(who);
+			if (entry == nullptr || entry->PendingPath.id != request_id) {
+				return;
+			}
+
+			entry->PendingPath.id = 0;
+			entry->ClearCommands();
+
+			IPathfinder::IPath adjusted_route = route;
+			ApplyPathGround(who, x, y, z, mode, adjusted_route, stuck);
+		}
 	);
+}
 
-	auto eiter = _impl->Entries.find(who);
-	auto &ent  = (*eiter);
+/**
+ * @param who
+ * @param x
+ * @param y
+ * @param z
+ * @param mode
+ * @param route
+ * @param stuck
+ */
+void MobMovementManager::ApplyPathGround(Mob *who, float x, float y, float z, MobMovementMode mode, IPathfinder::IPath &route, bool stuck)
+{
+	auto &ent = *_impl->FindEntry(who);
 
 	if (route.size() == 0) {
 		HandleStuckBehavior(who, x, y, z, mode);
@@ -1160,7 +1444,7 @@ void MobMovementManager::UpdatePathGround(Mob *who, float x, float y, float z, M
 		if (noValidPath) {
 			//we are 'stuck' in a path, lets just get out of this by 'teleporting' to the next position.
 			PushTeleportTo(
-				ent.second,
+				ent,
 				x,
 				y,
 				z,
@@ -1193,7 +1477,7 @@ void MobMovementManager::UpdatePathGround(Mob *who, float x, float y, float z, M
 
 			if (mode == MovementWalking) {
 				auto h = who->CalculateHeadingToTarget(next_node.pos.x, next_node.pos.y);
-				PushRotateTo(ent.second, who, h, mode);
+				PushRotateTo(ent, who, h, mode);
 			}
 
 			first_node = false;
@@ -1202,7 +1486,7 @@ void MobMovementManager::UpdatePathGround(Mob *who, float x, float y, float z, M
 		//move to / teleport to node + 1
 		if (next_node.teleport && next_node.pos.x != 0.0f && next_node.pos.y != 0.0f) {
 			PushTeleportTo(
-				ent.second,
+				ent,
 				next_node.pos.x,
 				next_node.pos.y,
 				next_node.pos.z,
@@ -1216,10 +1500,10 @@ void MobMovementManager::UpdatePathGround(Mob *who, float x, float y, float z, M
 		}
 		else {
 			if (zone->watermap->InLiquid(previous_pos)) {
-				PushSwimTo(ent.second, next_node.pos.x, next_node.pos.y, next_node.pos.z, mode);
+				PushSwimTo(ent, next_node.pos.x, next_node.pos.y, next_node.pos.z, mode);
 			}
 			else {
-				PushMoveTo(ent.second, next_node.pos.x, next_node.pos.y, next_node.pos.z, mode);
+				PushMoveTo(ent, next_node.pos.x, next_node.pos.y, next_node.pos.z, mode);
 			}
 		}
 	}
@@ -1228,10 +1512,41 @@ void MobMovementManager::UpdatePathGround(Mob *who, float x, float y, float z, M
 		HandleStuckBehavior(who, x, y, z, mode);
 	}
 	else {
-		PushStopMoving(ent.second);
+		PushStopMoving(ent);
 	}
 }
 
+/**
+ * @param who
+ * @param ent
+ */
+void MobMovementManager::ProcessPathFallback(Mob *who, MobMovementEntry &ent)
+{
+	auto &request = ent.PendingPath;
+	if (request.fallback_taken) {
+		return;
+	}
+
+	if (Timer::GetCurrentTime() - request.requested_time < static_cast<uint32>(RuleI(Pathing, AsyncPathFallbackTime))) {
+		return;
+	}
+
+	request.fallback_taken = true;
+
+	//the path is late and we are standing still, take a single straight line step toward the destination
+	glm::vec2 pos(who->GetX(), who->GetY());
+	glm::vec2 tar(ent.NavTo.navigate_to_x, ent.NavTo.navigate_to_y);
+	float     len = glm::distance(pos, tar);
+	if (len < 1.0f) {
+		return;
+	}
+
+	float     step = std::min(len, static_cast<float>(RuleR(Pathing, NavmeshStepSize)));
+	glm::vec2 npos = pos + glm::normalize(tar - pos) * step;
+
+	PushMoveTo(ent, npos.x, npos.y, who->GetZ(), request.mode);
+}
+
 /**
  * @param who
  * @param x
@@ -1241,12 +1556,11 @@ void MobMovementManager::UpdatePathGround(Mob *who, float x, float y, float z, M
  */
 void MobMovementManager::UpdatePathUnderwater(Mob *who, float x, float y, float z, MobMovementMode movement_mode)
 {
-	auto eiter = _impl->Entries.find(who);
-	auto &ent  = (*eiter);
+	auto &ent = *_impl->FindEntry(who);
 	if (zone->watermap->InLiquid(who->GetPosition()) && zone->watermap->InLiquid(glm::vec3(x, y, z)) &&
 		zone->zonemap->CheckLoS(who->GetPosition(), glm::vec3(x, y, z))) {
-		PushSwimTo(ent.second, x, y, z, movement_mode);
-		PushStopMoving(ent.second);
+		PushSwimTo(ent, x, y, z, movement_mode);
+		PushStopMoving(ent);
 		return;
 	}
 
@@ -1317,7 +1631,7 @@ void MobMovementManager::UpdatePathUnderwater(Mob *who, float x, float y, float
 
 			if (movement_mode == MovementWalking) {
 				auto h = who->CalculateHeadingToTarget(next_node.pos.x, next_node.pos.y);
-				PushRotateTo(ent.second, who, h, movement_mode);
+				PushRotateTo(ent, who, h, movement_mode);
 			}
 
 			first_node = false;
@@ -1326,7 +1640,7 @@ void MobMovementManager::UpdatePathUnderwater(Mob *who, float x, float y, float
 		//move to / teleport to node + 1
 		if (next_node.teleport && next_node.pos.x != 0.0f && next_node.pos.y != 0.0f) {
 			PushTeleportTo(
-				ent.second, next_node.pos.x, next_node.pos.y, next_node.pos.z,
+				ent, next_node.pos.x, next_node.pos.y, next_node.pos.z,
 				CalculateHeadingAngleBetweenPositions(
 					current_node.pos.x,
 					current_node.pos.y,
@@ -1335,7 +1649,7 @@ void MobMovementManager::UpdatePathUnderwater(Mob *who, float x, float y, float
 				));
 		}
 		else {
-			PushSwimTo(ent.second, next_node.pos.x, next_node.pos.y, next_node.pos.z, movement_mode);
+			PushSwimTo(ent, next_node.pos.x, next_node.pos.y, next_node.pos.z, movement_mode);
 		}
 	}
 
@@ -1343,7 +1657,7 @@ void MobMovementManager::UpdatePathUnderwater(Mob *who, float x, float y, float
 		HandleStuckBehavior(who, x, y, z, movement_mode);
 	}
 	else {
-		PushStopMoving(ent.second);
+		PushStopMoving(ent);
 	}
 }
 
@@ -1356,11 +1670,10 @@ void MobMovementManager::UpdatePathUnderwater(Mob *who, float x, float y, float
  */
 void MobMovementManager::UpdatePathBoat(Mob *who, float x, float y, float z, MobMovementMode mode)
 {
-	auto eiter = _impl->Entries.find(who);
-	auto &ent  = (*eiter);
+	auto &ent = *_impl->FindEntry(who);
 
-	PushSwimTo(ent.second, x, y, z, mode);
-	PushStopMoving(ent.second);
+	PushSwimTo(ent, x, y, z, mode);
+	PushStopMoving(ent);
 }
 
 /**
@@ -1372,7 +1685,13 @@ void MobMovementManager::UpdatePathBoat(Mob *who, float x, float y, float z, Mob
  */
 void MobMovementManager::PushTeleportTo(MobMovementEntry &ent, float x, float y, float z, float heading)
 {
-	ent.Commands.push_back(std::unique_ptr<IMovementCommand>(new TeleportToCommand(x, y, z, heading)));
+	MovementCommand command;
+	command.type             = CommandTeleportTo;
+	command.teleport.x       = x;
+	command.teleport.y       = y;
+	command.teleport.z       = z;
+	command.teleport.heading = heading;
+	ent.PushCommand(command);
 }
 
 /**
@@ -1384,7 +1703,7 @@ void MobMovementManager::PushTeleportTo(MobMovementEntry &ent, float x, float y,
  */
 void MobMovementManager::PushMoveTo(MobMovementEntry &ent, float x, float y, float z, MobMovementMode mob_movement_mode)
 {
-	ent.Commands.push_back(std::unique_ptr<IMovementCommand>(new MoveToCommand(x, y, z, mob_movement_mode)));
+	ent.PushCommand(MakeMoveCommand(CommandMoveTo, x, y, z, mob_movement_mode));
 }
 
 /**
@@ -1396,7 +1715,7 @@ void MobMovementManager::PushMoveTo(MobMovementEntry &ent, float x, float y, flo
  */
 void MobMovementManager::PushSwimTo(MobMovementEntry &ent, float x, float y, float z, MobMovementMode mob_movement_mode)
 {
-	ent.Commands.push_back(std::unique_ptr<IMovementCommand>(new SwimToCommand(x, y, z, mob_movement_mode)));
+	ent.PushCommand(MakeMoveCommand(CommandSwimTo, x, y, z, mob_movement_mode));
 }
 
 /**
@@ -1424,7 +1743,13 @@ void MobMovementManager::PushRotateTo(MobMovementEntry &ent, Mob *who, float to,
 		diff -= 512.0;
 	}
 
-	ent.Commands.push_back(std::unique_ptr<IMovementCommand>(new RotateToCommand(to, diff > 0 ? 1.0 : -1.0, mob_movement_mode)));
+	MovementCommand command;
+	command.type                 = CommandRotateTo;
+	command.rotate.rotate_to     = to;
+	command.rotate.rotate_to_dir = diff > 0 ? 1.0 : -1.0;
+	command.rotate.mode          = mob_movement_mode;
+	command.rotate.started       = false;
+	ent.PushCommand(command);
 }
 
 /**
@@ -1436,7 +1761,7 @@ void MobMovementManager::PushRotateTo(MobMovementEntry &ent, Mob *who, float to,
  */
 void MobMovementManager::PushFlyTo(MobMovementEntry &ent, float x, float y, float z, MobMovementMode mob_movement_mode)
 {
-	ent.Commands.push_back(std::unique_ptr<IMovementCommand>(new FlyToCommand(x, y, z, mob_movement_mode)));
+	ent.PushCommand(MakeMoveCommand(CommandFlyTo, x, y, z, mob_movement_mode));
 }
 
 /**
@@ -1444,7 +1769,9 @@ void MobMovementManager::PushFlyTo(MobMovementEntry &ent, float x, float y, floa
  */
 void MobMovementManager::PushStopMoving(MobMovementEntry &mob_movement_entry)
 {
-	mob_movement_entry.Commands.push_back(std::unique_ptr<IMovementCommand>(new StopMovingCommand()));
+	MovementCommand command;
+	command.type = CommandStopMoving;
+	mob_movement_entry.PushCommand(command);
 }
 
 /**
@@ -1452,7 +1779,9 @@ void MobMovementManager::PushStopMoving(MobMovementEntry &mob_movement_entry)
  */
 void MobMovementManager::PushEvadeCombat(MobMovementEntry &mob_movement_entry)
 {
-	mob_movement_entry.Commands.push_back(std::unique_ptr<IMovementCommand>(new EvadeCombatCommand()));
+	MovementCommand command;
+	command.type = CommandEvadeCombat;
+	mob_movement_entry.PushCommand(command);
 }
 
 /**
@@ -1473,23 +1802,22 @@ void MobMovementManager::HandleStuckBehavior(Mob *who, float x, float y, float z
 		behavior = (MobStuckBehavior) sb;
 	}
 
-	auto eiter = _impl->Entries.find(who);
-	auto &ent = (*eiter);
+	auto &ent = *_impl->FindEntry(who);
 
 	switch (sb) {
 		case RunToTarget:
-			PushMoveTo(ent.second, x, y, z, mob_movement_mode);
-			PushStopMoving(ent.second);
+			PushMoveTo(ent, x, y, z, mob_movement_mode);
+			PushStopMoving(ent);
 			break;
 		case WarpToTarget:
-			PushTeleportTo(ent.second, x, y, z, 0.0f);
-			PushStopMoving(ent.second);
+			PushTeleportTo(ent, x, y, z, 0.0f);
+			PushStopMoving(ent);
 			break;
 		case TakeNoAction:
-			PushStopMoving(ent.second);
+			PushStopMoving(ent);
 			break;
 		case EvadeCombat:
-			PushEvadeCombat(ent.second);
+			PushEvadeCombat(ent);
 			break;
 	}
 }
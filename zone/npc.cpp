@@ -2644,17 +2644,7 @@ void NPC::SignalNPC(int _signal_id)
 }
 
 NPC_Emote_Struct* NPC::GetNPCEmote(uint16 emoteid, uint8 event_) {
-	LinkedListIterator<NPC_Emote_Struct*> iterator(zone->NPCEmoteList);
-	iterator.Reset();
-	while(iterator.MoreElements())
-	{
-		NPC_Emote_Struct* nes = iterator.GetData();
-		if (emoteid == nes->emoteid && event_ == nes->event_) {
-			return (nes);
-		}
-		iterator.Advance();
-	}
-	return (nullptr);
+	return zone->GetNPCEmote(emoteid, event_);
 }
 
 void NPC::DoNPCEmote(uint8 event_, uint16 emoteid)
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <glm/vec3.hpp>
+
+//A cached route was planned from somewhere in the same grid cell, so pin its end points back onto the caller's request
+//A single node route is only the destination (the no poly path fallback), so it never takes the caller's start
+//Templated on the route so it does not drag the zone headers in with it, Route is an IPathfinder::IPath
+template<typename Route>
+inline void FixupCachedRoute(Route &route, const glm::vec3 &start, const glm::vec3 &end, bool partial)
+{
+	if (route.empty()) {
+		return;
+	}
+
+	auto &first = route.front();
+	if (!first.teleport && route.size() > 1) {
+		first.pos.x = start.x;
+		first.pos.y = start.y;
+	}
+
+	auto &last = route.back();
+	if (!partial && !last.teleport) {
+		last.pos.x = end.x;
+		last.pos.y = end.y;
+	}
+}
@@ -2,6 +2,7 @@
 
 #include "map.h"
 #include <list>
+#include <functional>
 
 class Client;
 class Seperator;
@@ -69,12 +70,15 @@ public:
 	};
 
 	typedef std::list<IPathNode> IPath;
+	typedef std::function<void(const IPath &route, bool partial, bool stuck)> PathCallback;
 
 	IPathfinder() { }
 	virtual ~IPathfinder() { }
 
 	virtual IPath FindRoute(const glm::vec3 &start, const glm::vec3 &end, bool &partial, bool &stuck, int flags = PathingNotDisabled) = 0;
 	virtual IPath FindPath(const glm::vec3 &start, const glm::vec3 &end, bool &partial, bool &stuck, const PathfinderOptions& opts) = 0;
+	virtual void FindPathAsync(const glm::vec3 &start, const glm::vec3 &end, const PathfinderOptions& opts, PathCallback callback);
+	virtual void Process() { }
 	virtual glm::vec3 GetRandomLocation(const glm::vec3 &start) = 0;
 	virtual void DebugCommand(Client *c, const Seperator *sep) = 0;
 
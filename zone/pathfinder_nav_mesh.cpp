@@ -1,7 +1,15 @@
 #include <memory>
 #include <stdio.h>
 #include <vector>
+#include <list>
+#include <unordered_map>
+#include <cmath>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
 #include "pathfinder_nav_mesh.h"
+#include "pathfinder_cache.h"
 #include <DetourCommon.h>
 #include <DetourNavMeshQuery.h>
 
@@ -12,18 +20,194 @@
 
 extern Zone *zone;
 
+enum PathCacheQueryType : int
+{
+	PathCacheRoute = 0,
+	PathCachePath = 1
+};
+
+struct PathCacheKey
+{
+	PathCacheKey() {
+		start_ref = 0;
+		end_ref = 0;
+		memset(start_cell, 0, sizeof(start_cell));
+		memset(end_cell, 0, sizeof(end_cell));
+		type = PathCacheRoute;
+		flags = 0;
+		smooth_path = 0;
+		step_size = 0.0f;
+		offset = 0.0f;
+		memset(flag_cost, 0, sizeof(flag_cost));
+	}
+
+	bool operator==(const PathCacheKey &o) const {
+		return start_ref == o.start_ref &&
+			end_ref == o.end_ref &&
+			memcmp(start_cell, o.start_cell, sizeof(start_cell)) == 0 &&
+			memcmp(end_cell, o.end_cell, sizeof(end_cell)) == 0 &&
+			type == o.type &&
+			flags == o.flags &&
+			smooth_path == o.smooth_path &&
+			step_size == o.step_size &&
+			offset == o.offset &&
+			memcmp(flag_cost, o.flag_cost, sizeof(flag_cost)) == 0;
+	}
+
+	dtPolyRef start_ref;
+	dtPolyRef end_ref;
+	int32_t start_cell[3];
+	int32_t end_cell[3];
+	int32_t type;
+	int32_t flags;
+	int32_t smooth_path;
+	float step_size;
+	float offset;
+	float flag_cost[10];
+};
+
+struct PathCacheKeyHash
+{
+	size_t operator()(const PathCacheKey &key) const {
+		//FNV-1a, fields are hashed one at a time so struct padding never leaks into the hash
+		uint64_t hash = 14695981039346656037ULL;
+		Mix(hash, &key.start_ref, sizeof(key.start_ref));
+		Mix(hash, &key.end_ref, sizeof(key.end_ref));
+		Mix(hash, key.start_cell, sizeof(key.start_cell));
+		Mix(hash, key.end_cell, sizeof(key.end_cell));
+		Mix(hash, &key.type, sizeof(key.type));
+		Mix(hash, &key.flags, sizeof(key.flags));
+		Mix(hash, &key.smooth_path, sizeof(key.smooth_path));
+		Mix(hash, &key.step_size, sizeof(key.step_size));
+		Mix(hash, &key.offset, sizeof(key.offset));
+		Mix(hash, key.flag_cost, sizeof(key.flag_cost));
+		return static_cast<size_t>(hash);
+	}
+
+	static void Mix(uint64_t &hash, const void *data, size_t len) {
+		auto bytes = reinterpret_cast<const unsigned char*>(data);
+		for (size_t i = 0; i < len; ++i) {
+			hash ^= bytes[i];
+			hash *= 1099511628211ULL;
+		}
+	}
+};
+
+struct PathQuery
+{
+	PathCacheKey key;
+	dtPolyRef start_ref;
+	dtPolyRef end_ref;
+	glm::vec3 current_location;
+	glm::vec3 dest_location;
+	dtQueryFilter filter;
+	PathfinderOptions opts;
+	int max_nodes;
+	uint32 queued_time;
+};
+
+struct PathResult
+{
+	PathCacheKey key;
+	IPathfinder::IPath route;
+	bool partial;
+	bool stuck;
+	uint32 queued_time;
+};
+
+struct PathWaiter
+{
+	glm::vec3 start;
+	glm::vec3 end;
+	IPathfinder::PathCallback callback;
+};
+
+struct PathCacheEntry
+{
+	PathCacheKey key;
+	IPathfinder::IPath route;
+	bool partial;
+	bool stuck;
+};
+
+struct PathCacheStats
+{
+	PathCacheStats() {
+		Clear();
+	}
+
+	void Clear() {
+		last_reset_time = static_cast<double>(Timer::GetCurrentTime()) / 1000.0;
+		hits = 0;
+		misses = 0;
+		evictions = 0;
+		queued = 0;
+		coalesced = 0;
+		completed = 0;
+		total_latency = 0;
+	}
+
+	double last_reset_time;
+	uint64_t hits;
+	uint64_t misses;
+	uint64_t evictions;
+	uint64_t queued;
+	uint64_t coalesced;
+	uint64_t completed;
+	uint64_t total_latency;
+};
+
 struct PathfinderNavmesh::Implementation
 {
 	dtNavMesh *nav_mesh;
 	dtNavMeshQuery *query;
+
+	//most recently used paths are kept at the front
+	std::list<PathCacheEntry> path_cache;
+	std::unordered_map<PathCacheKey, std::list<PathCacheEntry>::iterator, PathCacheKeyHash> path_cache_index;
+	PathCacheStats path_cache_stats;
+
+	//requests handed to the worker pool, keyed so identical requests share one query
+	std::unordered_map<PathCacheKey, std::vector<PathWaiter>, PathCacheKeyHash> pending_paths;
+
+	//each worker owns its own dtNavMeshQuery, the nav mesh itself is read only once loaded
+	std::vector<std::thread> workers;
+	bool workers_running;
+	std::mutex work_lock;
+	std::condition_variable work_cv;
+	std::deque<PathQuery> work;
+	std::mutex result_lock;
+	std::vector<PathResult> results;
 };
 
+static int32_t QuantizePathCoord(float v, float grid_size)
+{
+	return static_cast<int32_t>(std::floor(v / grid_size));
+}
+
+static void SetPathCacheEndpoints(PathCacheKey &key, const glm::vec3 &start, const glm::vec3 &end)
+{
+	float grid_size = RuleR(Pathing, PathCacheGridSize);
+	if (grid_size < 0.1f) {
+		grid_size = 0.1f;
+	}
+
+	key.start_cell[0] = QuantizePathCoord(start.x, grid_size);
+	key.start_cell[1] = QuantizePathCoord(start.y, grid_size);
+	key.start_cell[2] = QuantizePathCoord(start.z, grid_size);
+	key.end_cell[0] = QuantizePathCoord(end.x, grid_size);
+	key.end_cell[1] = QuantizePathCoord(end.y, grid_size);
+	key.end_cell[2] = QuantizePathCoord(end.z, grid_size);
+}
+
 PathfinderNavmesh::PathfinderNavmesh(const std::string &path)
 {
 	m_impl.reset(new Implementation());
 	m_impl->nav_mesh = nullptr;
 	m_impl->query = nullptr;
+	m_impl->workers_running = false;
 	Load(path);
+	StartWorkers(RuleI(Pathing, AsyncWorkerThreads));
 }
 
 PathfinderNavmesh::~PathfinderNavmesh()
@@ -70,10 +254,37 @@ IPathfinder::IPath PathfinderNavmesh::FindRoute(const glm::vec3 &start, const gl
 	if (!start_ref || !end_ref) {
 		return IPath();
 	}
-	
+
+	PathCacheKey key;
+	key.type = PathCacheRoute;
+	key.start_ref = start_ref;
+	key.end_ref = end_ref;
+	key.flags = flags;
+	SetPathCacheEndpoints(key, start, end);
+
+	IPath route;
+	bool route_stuck = false;
+	if (!FindCachedPath(key, route, partial, route_stuck)) {
+		route = CalcRoute(start_ref, end_ref, current_location, dest_location, end, &filter, partial, route_stuck);
+		CachePath(key, route, partial, route_stuck);
+	}
+	else {
+		FixupCachedRoute(route, start, end, partial);
+	}
+
+	if (route_stuck) {
+		stuck = true;
+	}
+
+	return route;
+}
+
+IPathfinder::IPath PathfinderNavmesh::CalcRoute(dtPolyRef start_ref, dtPolyRef end_ref, glm::vec3 &current_location, glm::vec3 &dest_location,
+	const glm::vec3 &end, const dtQueryFilter *filter, bool &partial, bool &stuck)
+{
 	int npoly = 0;
 	dtPolyRef path[1024] = { 0 };
-	auto status = m_impl->query->findPath(start_ref, end_ref, &current_location[0], &dest_location[0], &filter, path, &npoly, 1024);
+	auto status = m_impl->query->findPath(start_ref, end_ref, &current_location[0], &dest_location[0], filter, path, &npoly, 1024);
 	
 	if (npoly) {
 		glm::vec3 epos = dest_location;
@@ -132,20 +343,128 @@ IPathfinder::IPath PathfinderNavmesh::FindRoute(const glm::vec3 &start, const gl
 IPathfinder::IPath PathfinderNavmesh::FindPath(const glm::vec3 &start, const glm::vec3 &end, bool &partial, bool &stuck, const PathfinderOptions &opts)
 {
 	partial = false;
-	
-	if (!m_impl->nav_mesh) {
+
+	PathQuery q;
+	if (!PreparePathQuery(start, end, opts, q)) {
 		return IPath();
 	}
-	
+
+	IPath route;
+	bool route_stuck = false;
+	if (!FindCachedPath(q.key, route, partial, route_stuck)) {
+		route = CalcPath(m_impl->query, q, partial, route_stuck);
+		CachePath(q.key, route, partial, route_stuck);
+	}
+	else {
+		FixupCachedRoute(route, start, end, partial);
+	}
+
+	if (route_stuck) {
+		stuck = true;
+	}
+
+	return route;
+}
+
+void PathfinderNavmesh::FindPathAsync(const glm::vec3 &start, const glm::vec3 &end, const PathfinderOptions &opts, PathCallback callback)
+{
+	if (m_impl->workers.empty()) {
+		IPathfinder::FindPathAsync(start, end, opts, callback);
+		return;
+	}
+
+	PathQuery q;
+	if (!PreparePathQuery(start, end, opts, q)) {
+		callback(IPath(), false, false);
+		return;
+	}
+
+	IPath route;
+	bool partial = false;
+	bool stuck = false;
+	if (FindCachedPath(q.key, route, partial, stuck)) {
+		FixupCachedRoute(route, start, end, partial);
+		callback(route, partial, stuck);
+		return;
+	}
+
+	PathWaiter waiter;
+	waiter.start = start;
+	waiter.end = end;
+	waiter.callback = callback;
+
+	//an identical path is already being worked on, wait for that one instead of queuing another
+	auto pending = m_impl->pending_paths.find(q.key);
+	if (pending != m_impl->pending_paths.end()) {
+		pending->second.push_back(waiter);
+		m_impl->path_cache_stats.coalesced++;
+		return;
+	}
+
+	m_impl->pending_paths[q.key].push_back(waiter);
+	m_impl->path_cache_stats.queued++;
+
+	{
+		std::unique_lock<std::mutex> lock(m_impl->work_lock);
+		m_impl->work.push_back(q);
+	}
+
+	m_impl->work_cv.notify_one();
+}
+
+void PathfinderNavmesh::Process()
+{
+	if (m_impl->workers.empty()) {
+		return;
+	}
+
+	std::vector<PathResult> results;
+	{
+		std::unique_lock<std::mutex> lock(m_impl->result_lock);
+		results.swap(m_impl->results);
+	}
+
+	auto current_time = Timer::GetCurrentTime();
+	for (auto &result : results) {
+		CachePath(result.key, result.route, result.partial, result.stuck);
+		m_impl->path_cache_stats.completed++;
+		m_impl->path_cache_stats.total_latency += current_time - result.queued_time;
+
+		auto pending = m_impl->pending_paths.find(result.key);
+		if (pending == m_impl->pending_paths.end()) {
+			continue;
+		}
+
+		//callbacks can post new requests so take ownership of the waiters before running them
+		auto waiters = std::move(pending->second);
+		m_impl->pending_paths.erase(pending);
+
+		for (auto &waiter : waiters) {
+			IPath route = result.route;
+			FixupCachedRoute(route, waiter.start, waiter.end, result.partial);
+			waiter.callback(route, result.partial, result.stuck);
+		}
+	}
+}
+
+bool PathfinderNavmesh::PreparePathQuery(const glm::vec3 &start, const glm::vec3 &end, const PathfinderOptions &opts, PathQuery &q)
+{
+	if (!m_impl->nav_mesh) {
+		return false;
+	}
+
 	if (!m_impl->query) {
 		m_impl->query = dtAllocNavMeshQuery();
 	}
-	
+
 	m_impl->query->init(m_impl->nav_mesh, RuleI(Pathing, MaxNavmeshNodes));
-	glm::vec3 current_location(start.x, start.z, start.y);
-	glm::vec3 dest_location(end.x, end.z, end.y);
-	
-	dtQueryFilter filter;
+	q.opts = opts;
+	q.current_location = glm::vec3(start.x, start.z, start.y);
+	q.dest_location = glm::vec3(end.x, end.z, end.y);
+	q.max_nodes = RuleI(Pathing, MaxNavmeshNodes);
+	q.queued_time = Timer::GetCurrentTime();
+
+	auto &filter = q.filter;
 	filter.setIncludeFlags(opts.flags);
 	filter.setAreaCost(0, opts.flag_cost[0]); //Normal
 	filter.setAreaCost(1, opts.flag_cost[1]); //Water
@@ -157,27 +476,45 @@ IPathfinder::IPath PathfinderNavmesh::FindPath(const glm::vec3 &start, const glm
 	filter.setAreaCost(8, opts.flag_cost[7]); //General Area
 	filter.setAreaCost(9, opts.flag_cost[8]); //Portal
 	filter.setAreaCost(10, opts.flag_cost[9]); //Prefer
-	
-	static const int max_polys = 256;
-	dtPolyRef start_ref;
-	dtPolyRef end_ref;
+
 	glm::vec3 ext(10.0f, 200.0f, 10.0f);
-	
-	m_impl->query->findNearestPoly(&current_location[0], &ext[0], &filter, &start_ref, 0);
-	m_impl->query->findNearestPoly(&dest_location[0], &ext[0], &filter, &end_ref, 0);
-	
-	if (!start_ref || !end_ref) {
-		return IPath();
+
+	q.start_ref = 0;
+	q.end_ref = 0;
+	m_impl->query->findNearestPoly(&q.current_location[0], &ext[0], &filter, &q.start_ref, 0);
+	m_impl->query->findNearestPoly(&q.dest_location[0], &ext[0], &filter, &q.end_ref, 0);
+
+	if (!q.start_ref || !q.end_ref) {
+		return false;
 	}
-	
+
+	auto &key = q.key;
+	key.type = PathCachePath;
+	key.start_ref = q.start_ref;
+	key.end_ref = q.end_ref;
+	key.flags = opts.flags;
+	key.smooth_path = opts.smooth_path ? 1 : 0;
+	key.step_size = opts.step_size;
+	key.offset = opts.offset;
+	memcpy(key.flag_cost, opts.flag_cost, sizeof(key.flag_cost));
+	SetPathCacheEndpoints(key, start, end);
+	return true;
+}
+
+IPathfinder::IPath PathfinderNavmesh::CalcPath(dtNavMeshQuery *query, PathQuery &q, bool &partial, bool &stuck) const
+{
+	static const int max_polys = 256;
+	auto &opts = q.opts;
+	auto &current_location = q.current_location;
+	auto &dest_location = q.dest_location;
 	int npoly = 0;
 	dtPolyRef path[max_polys] = { 0 };
-	auto status = m_impl->query->findPath(start_ref, end_ref, &current_location[0], &dest_location[0], &filter, path, &npoly, max_polys);
+	auto status = query->findPath(q.start_ref, q.end_ref, &current_location[0], &dest_location[0], &q.filter, path, &npoly, max_polys);
 	
 	if (npoly) {
 		glm::vec3 epos = dest_location;
-		if (path[npoly - 1] != end_ref) {
-			m_impl->query->closestPointOnPoly(path[npoly - 1], &dest_location[0], &epos[0], 0);
+		if (path[npoly - 1] != q.end_ref) {
+			query->closestPointOnPoly(path[npoly - 1], &dest_location[0], &epos[0], 0);
 			partial = true;
 			
 			auto dist = DistanceSquared(epos, current_location);
@@ -191,7 +528,7 @@ IPathfinder::IPath PathfinderNavmesh::FindPath(const glm::vec3 &start, const glm
 		unsigned char straight_path_flags[max_polys];
 		dtPolyRef straight_path_polys[max_polys];
 	
-		auto status = m_impl->query->findStraightPath(&current_location[0], &epos[0], path, npoly,
+		auto status = query->findStraightPath(&current_location[0], &epos[0], path, npoly,
 			(float*)&straight_path[0], straight_path_flags,
 			straight_path_polys, &n_straight_polys, 2048, DT_STRAIGHTPATH_AREA_CROSSINGS | DT_STRAIGHTPATH_ALL_CROSSINGS);
 	
@@ -354,6 +691,27 @@ void PathfinderNavmesh::DebugCommand(Client *c, const Seperator *sep)
 	if (sep->arg[1][0] == '\0' || !strcasecmp(sep->arg[1], "help"))
 	{
 		c->Message(Chat::White, "#path show: Plots a path from the user to their target.");
+		c->Message(Chat::White, "#path stats: Shows path cache statistics.");
+		c->Message(Chat::White, "#path clearstats: Resets path cache statistics.");
+		c->Message(Chat::White, "#path clearcache: Empties the path cache.");
+		return;
+	}
+
+	if (!strcasecmp(sep->arg[1], "stats"))
+	{
+		DumpPathCacheStats(c);
+		return;
+	}
+
+	if (!strcasecmp(sep->arg[1], "clearstats"))
+	{
+		m_impl->path_cache_stats.Clear();
+		return;
+	}
+
+	if (!strcasecmp(sep->arg[1], "clearcache"))
+	{
+		ClearPathCache();
 		return;
 	}
 
@@ -373,6 +731,9 @@ void PathfinderNavmesh::DebugCommand(Client *c, const Seperator *sep)
 
 void PathfinderNavmesh::Clear()
 {
+	StopWorkers();
+	ClearPathCache();
+
 	if (m_impl->nav_mesh) {
 		dtFreeNavMesh(m_impl->nav_mesh);
 	}
@@ -380,6 +741,9 @@ void PathfinderNavmesh::Clear()
 	if (m_impl->query) {
 		dtFreeNavMeshQuery(m_impl->query);
 	}
+
+	m_impl->nav_mesh = nullptr;
+	m_impl->query = nullptr;
 }
 
 void PathfinderNavmesh::Load(const std::string &path)
@@ -561,3 +925,175 @@ dtStatus PathfinderNavmesh::GetPolyHeightOnPath(const dtPolyRef *path, const int
 
 	return DT_FAILURE;
 }
+
+bool PathfinderNavmesh::FindCachedPath(const PathCacheKey &key, IPath &route, bool &partial, bool &stuck)
+{
+	if (RuleI(Pathing, PathCacheSize) <= 0) {
+		return false;
+	}
+
+	auto iter = m_impl->path_cache_index.find(key);
+	if (iter == m_impl->path_cache_index.end()) {
+		m_impl->path_cache_stats.misses++;
+		return false;
+	}
+
+	m_impl->path_cache_stats.hits++;
+	m_impl->path_cache.splice(m_impl->path_cache.begin(), m_impl->path_cache, iter->second);
+
+	auto &entry = m_impl->path_cache.front();
+	route = entry.route;
+	partial = entry.partial;
+	stuck = entry.stuck;
+	return true;
+}
+
+void PathfinderNavmesh::CachePath(const PathCacheKey &key, const IPath &route, bool partial, bool stuck)
+{
+	auto max_entries = RuleI(Pathing, PathCacheSize);
+	if (max_entries <= 0) {
+		return;
+	}
+
+	if (m_impl->path_cache_index.count(key) > 0) {
+		return;
+	}
+
+	while (!m_impl->path_cache.empty() && m_impl->path_cache.size() >= static_cast<size_t>(max_entries)) {
+		m_impl->path_cache_index.erase(m_impl->path_cache.back().key);
+		m_impl->path_cache.pop_back();
+		m_impl->path_cache_stats.evictions++;
+	}
+
+	PathCacheEntry entry;
+	entry.key = key;
+	entry.route = route;
+	entry.partial = partial;
+	entry.stuck = stuck;
+
+	m_impl->path_cache.push_front(entry);
+	m_impl->path_cache_index[key] = m_impl->path_cache.begin();
+}
+
+void PathfinderNavmesh::StartWorkers(int count)
+{
+	if (!m_impl->nav_mesh || m_impl->workers_running || count <= 0) {
+		return;
+	}
+
+	m_impl->workers_running = true;
+	for (int i = 0; i < count; ++i) {
+		m_impl->workers.push_back(std::thread(&PathfinderNavmesh::ProcessWork, this));
+	}
+
+	LogInfo("Started [{}] navmesh pathing worker threads", count);
+}
+
+void PathfinderNavmesh::StopWorkers()
+{
+	if (!m_impl->workers_running) {
+		return;
+	}
+
+	{
+		std::unique_lock<std::mutex> lock(m_impl->work_lock);
+		m_impl->workers_running = false;
+	}
+
+	m_impl->work_cv.notify_all();
+
+	for (auto &t : m_impl->workers) {
+		t.join();
+	}
+
+	m_impl->workers.clear();
+	m_impl->work.clear();
+	m_impl->results.clear();
+	m_impl->pending_paths.clear();
+}
+
+void PathfinderNavmesh::ProcessWork()
+{
+	dtNavMeshQuery *query = dtAllocNavMeshQuery();
+	int query_nodes = 0;
+
+	for (;;) {
+		PathQuery q;
+
+		{
+			std::unique_lock<std::mutex> lock(m_impl->work_lock);
+			m_impl->work_cv.wait(lock, [this] { return !m_impl->workers_running || !m_impl->work.empty(); });
+
+			if (!m_impl->workers_running) {
+				break;
+			}
+
+			q = m_impl->work.front();
+			m_impl->work.pop_front();
+		}
+
+		if (query_nodes != q.max_nodes) {
+			query->init(m_impl->nav_mesh, q.max_nodes);
+			query_nodes = q.max_nodes;
+		}
+
+		PathResult result;
+		result.key = q.key;
+		result.partial = false;
+		result.stuck = false;
+		result.queued_time = q.queued_time;
+		result.route = CalcPath(query, q, result.partial, result.stuck);
+
+		{
+			std::unique_lock<std::mutex> lock(m_impl->result_lock);
+			m_impl->results.push_back(std::move(result));
+		}
+	}
+
+	dtFreeNavMeshQuery(query);
+}
+
+void PathfinderNavmesh::ClearPathCache()
+{
+	m_impl->path_cache.clear();
+	m_impl->path_cache_index.clear();
+}
+
+void PathfinderNavmesh::DumpPathCacheStats(Client *c)
+{
+	auto &stats = m_impl->path_cache_stats;
+	auto current_time = static_cast<double>(Timer::GetCurrentTime()) / 1000.0;
+	auto total_time = current_time - stats.last_reset_time;
+	auto lookups = stats.hits + stats.misses;
+
+	c->Message(Chat::System, "Dumping Path Cache Stats:");
+	c->Message(
+		Chat::System,
+		"Entries: %u / %d",
+		static_cast<uint32>(m_impl->path_cache.size()),
+		RuleI(Pathing, PathCacheSize)
+	);
+	c->Message(
+		Chat::System,
+		"Lookups: %u (%.2f / sec)",
+		static_cast<uint32>(lookups),
+		total_time > 0.0 ? static_cast<double>(lookups) / total_time : 0.0
+	);
+	c->Message(
+		Chat::System,
+		"Hits: %u Misses: %u (%.2f%% hit rate)",
+		static_cast<uint32>(stats.hits),
+		static_cast<uint32>(stats.misses),
+		lookups > 0 ? static_cast<double>(stats.hits) * 100.0 / static_cast<double>(lookups) : 0.0
+	);
+	c->Message(Chat::System, "Evictions: %u", static_cast<uint32>(stats.evictions));
+	c->Message(
+		Chat::System,
+		"Workers: %u Queued: %u Coalesced: %u Completed: %u (%.2f ms avg latency)",
+		static_cast<uint32>(m_impl->workers.size()),
+		static_cast<uint32>(stats.queued),
+		static_cast<uint32>(stats.coalesced),
+		static_cast<uint32>(stats.completed),
+		stats.completed > 0 ? static_cast<double>(stats.total_latency) / static_cast<double>(stats.completed) : 0.0
+	);
+}
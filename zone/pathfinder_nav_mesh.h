@@ -4,6 +4,11 @@
 #include <string>
 #include <DetourNavMesh.h>
 
+class dtQueryFilter;
+class dtNavMeshQuery;
+struct PathCacheKey;
+struct PathQuery;
+
 class PathfinderNavmesh : public IPathfinder
 {
 public:
@@ -12,6 +17,8 @@ public:
 
 	virtual IPath FindRoute(const glm::vec3 &start, const glm::vec3 &end, bool &partial, bool &stuck, int flags = PathingNotDisabled);
 	virtual IPath FindPath(const glm::vec3 &start, const glm::vec3 &end, bool &partial, bool &stuck, const PathfinderOptions& opts);
+	virtual void FindPathAsync(const glm::vec3 &start, const glm::vec3 &end, const PathfinderOptions& opts, PathCallback callback);
+	virtual void Process();
 	virtual glm::vec3 GetRandomLocation(const glm::vec3 &start);
 	virtual void DebugCommand(Client *c, const Seperator *sep);
 
@@ -21,6 +28,17 @@ private:
 	void ShowPath(Client *c, const glm::vec3 &start, const glm::vec3 &end);
 	dtStatus GetPolyHeightNoConnections(dtPolyRef ref, const float *pos, float *height) const;
 	dtStatus GetPolyHeightOnPath(const dtPolyRef *path, const int path_len, const glm::vec3 &pos, float *h) const;
+	IPath CalcRoute(dtPolyRef start_ref, dtPolyRef end_ref, glm::vec3 &current_location, glm::vec3 &dest_location,
+		const glm::vec3 &end, const dtQueryFilter *filter, bool &partial, bool &stuck);
+	bool PreparePathQuery(const glm::vec3 &start, const glm::vec3 &end, const PathfinderOptions &opts, PathQuery &q);
+	IPath CalcPath(dtNavMeshQuery *query, PathQuery &q, bool &partial, bool &stuck) const;
+	void StartWorkers(int count);
+	void StopWorkers();
+	void ProcessWork();
+	bool FindCachedPath(const PathCacheKey &key, IPath &route, bool &partial, bool &stuck);
+	void CachePath(const PathCacheKey &key, const IPath &route, bool partial, bool stuck);
+	void ClearPathCache();
+	void DumpPathCacheStats(Client *c);
 
 	struct Implementation;
 	std::unique_ptr<Implementation> m_impl;
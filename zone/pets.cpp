@@ -611,6 +611,8 @@ void NPC::SetPetState(SpellBuff_Struct *pet_buffs, uint32 *items) {
 		}
 	}
 
+	SyncBuffEffects();
+
 	//restore their equipment...
 	for (i = EQ::invslot::EQUIPMENT_BEGIN; i <= EQ::invslot::EQUIPMENT_END; i++) {
 		if(items[i] == 0)
@@ -22,6 +22,9 @@ Copyright (C) 2001-2014 EQEMu Development Team (http://eqemulator.net)
 #include "queryserv.h"
 #include "worldserver.h"
 
+#include <string.h>
+#include <time.h>
+
 
 extern WorldServer worldserver;
 extern QueryServ* QServ;
@@ -43,8 +46,26 @@ void QueryServ::SendQuery(std::string Query)
 
 void QueryServ::PlayerLogEvent(int Event_Type, int Character_ID, std::string Event_Desc)
 {
-	std::string query = StringFormat(
-			"INSERT INTO `qs_player_events` (event, char_id, event_desc, time) VALUES (%i, %i, '%s', UNIX_TIMESTAMP(now()))",
-			Event_Type, Character_ID, EscapeString(Event_Desc).c_str());
-	SendQuery(query);
+	/* Sent as a structured event, queryserv builds the insert and batches it */
+	auto pack = new ServerPacket(ServerOP_QSPlayerLogEvent, sizeof(QSPlayerLogEvent_Struct) + Event_Desc.length() + 1);
+	auto qs = (QSPlayerLogEvent_Struct *) pack->pBuffer;
+	qs->event_type = Event_Type;
+	qs->char_id = Character_ID;
+	qs->time = static_cast<uint32>(time(nullptr));
+	qs->event_desc_length = Event_Desc.length();
+	memcpy(qs->event_desc, Event_Desc.c_str(), Event_Desc.length() + 1);
+	worldserver.SendPacket(pack);
+	safe_delete(pack);
+}
+
+void QueryServ::PlayerLogAARate(int Character_ID, int AA_Count)
+{
+	auto pack = new ServerPacket(ServerOP_QSPlayerAARate, sizeof(QSPlayerAARate_Struct));
+	auto qs = (QSPlayerAARate_Struct *) pack->pBuffer;
+	uint32 now = static_cast<uint32>(time(nullptr));
+	qs->char_id = Character_ID;
+	qs->aa_count = AA_Count;
+	qs->hour_time = now - (now % 3600);
+	worldserver.SendPacket(pack);
+	safe_delete(pack);
 }
@@ -30,6 +30,7 @@ class QueryServ{
 		~QueryServ();
 		void SendQuery(std::string Query);
 		void PlayerLogEvent(int Event_Type, int Character_ID, std::string Event_Desc);
+		void PlayerLogAARate(int Character_ID, int AA_Count);
 };
 
 #endif /* QUERYSERV_ZONE_H */ 
\ No newline at end of file
@@ -86,6 +86,7 @@ Spawn2::Spawn2(uint32 in_spawn2_id, uint32 spawngroup_id,
 	npcthis = nullptr;
 	enabled = in_enabled;
 	this->anim = anim;
+	schedule_token = 0;
 
 	if(timeleft == 0xFFFFFFFF) {
 		//special disable timeleft
@@ -98,10 +99,20 @@ Spawn2::Spawn2(uint32 in_spawn2_id, uint32 spawngroup_id,
 		timer.Start(resetTimer());
 		timer.Trigger();
 	}
+
+	Schedule();
 }
 
 Spawn2::~Spawn2()
 {
+	if (zone)
+		zone->UnscheduleSpawn2(this);
+}
+
+void Spawn2::Schedule()
+{
+	if (zone)
+		zone->ScheduleSpawn2(this);
 }
 
 uint32 Spawn2::resetTimer()
@@ -336,11 +347,13 @@ void Spawn2::LoadGrid(int start_wp) {
 void Spawn2::Reset() {
 	timer.Start(resetTimer());
 	npcthis = nullptr;
+	Schedule();
 	LogSpawns("Spawn2 [{}]: Spawn reset, repop in [{}] ms", spawn2_id, timer.GetRemainingTime());
 }
 
 void Spawn2::Depop() {
 	timer.Disable();
+	Schedule();
 	LogSpawns("Spawn2 [{}]: Spawn reset, repop disabled", spawn2_id);
 	npcthis = nullptr;
 }
@@ -354,6 +367,7 @@ void Spawn2::Repop(uint32 delay) {
 		timer.Start(delay);
 	}
 	npcthis = nullptr;
+	Schedule();
 }
 
 void Spawn2::ForceDespawn()
@@ -397,6 +411,7 @@ void Spawn2::ForceDespawn()
 
 	LogSpawns("Spawn2 [{}]: Spawn group [{}] set despawn timer to [{}] ms", spawn2_id, spawngroup_id_, cur);
 	timer.Start(cur);
+	Schedule();
 }
 
 //resets our spawn as if we just died
@@ -409,6 +424,7 @@ void Spawn2::DeathReset(bool realdeath)
 
 	//zero out our NPC since he is now gone
 	npcthis = nullptr;
+	Schedule();
 
 	if(realdeath) { killcount++; }
 
@@ -685,6 +701,84 @@ uint32 Zone::CountSpawn2() {
 	return count;
 }
 
+uint64 Zone::Spawn2Clock() {
+	// Timer::GetCurrentTime is a wrapping 32 bit ms counter, the heap wants something monotonic
+	uint32 now = Timer::GetCurrentTime();
+	spawn2_clock += now - spawn2_clock_last;
+	spawn2_clock_last = now;
+
+	return spawn2_clock;
+}
+
+void Zone::ScheduleSpawn2(Spawn2 *spawn) {
+	UnscheduleSpawn2(spawn);
+
+	if (!spawn->timer.Enabled())
+		return;
+
+	spawn->schedule_token = ++spawn2_schedule_token;
+	spawn2_scheduled[spawn->schedule_token] = spawn;
+	// Timer::Check only fires once the elapsed time is strictly past the duration
+	spawn2_deadlines.push(std::make_pair(Spawn2Clock() + spawn->timer.GetRemainingTime() + 1, spawn->schedule_token));
+}
+
+void Zone::UnscheduleSpawn2(Spawn2 *spawn) {
+	if (spawn->schedule_token == 0)
+		return;
+
+	spawn2_scheduled.erase(spawn->schedule_token);
+	spawn->schedule_token = 0;
+}
+
+void Zone::ProcessSpawn2Deadlines() {
+	uint64 now = Spawn2Clock();
+
+	// take everything that is due up front, anything scheduled while these run waits for the next tick
+	std::vector<uint64> due;
+	while (!spawn2_deadlines.empty() && spawn2_deadlines.top().first <= now) {
+		if (spawn2_scheduled.count(spawn2_deadlines.top().second))
+			due.push_back(spawn2_deadlines.top().second);
+		spawn2_deadlines.pop();
+	}
+
+	uint32 processed = 0;
+	for (auto token : due) {
+		auto iter = spawn2_scheduled.find(token);
+		if (iter == spawn2_scheduled.end())
+			continue;
+
+		Spawn2 *spawn = iter->second;
+		UnscheduleSpawn2(spawn);
+		processed++;
+
+		if (!spawn->Process()) {
+			LinkedListIterator<Spawn2 *> iterator(spawn2_list);
+
+			iterator.Reset();
+			while (iterator.MoreElements()) {
+				if (iterator.GetData() == spawn) {
+					iterator.RemoveCurrent();
+					break;
+				}
+				iterator.Advance();
+			}
+			continue;
+		}
+
+		// Still expired means Process was blocked (spawn point disabled, or its npc is still up and
+		// doesn't despawn). Leave it off the heap, Enable/SetNPCPointerNull/Reset and friends put it back.
+		if (spawn->schedule_token == 0 && !spawn->timer.Check(false))
+			ScheduleSpawn2(spawn);
+	}
+
+	spawn2_processed_last_tick = processed;
+	if (processed > spawn2_processed_peak)
+		spawn2_processed_peak = processed;
+
+	if (processed > 0)
+		LogSpawnsDetail("Processed [{}] due spawn points, [{}] still scheduled", processed, spawn2_scheduled.size());
+}
+
 void Zone::Despawn(uint32 spawn2ID) {
 	LinkedListIterator<Spawn2*> iterator(spawn2_list);
 
@@ -734,6 +828,7 @@ void Spawn2::SpawnConditionChanged(const SpawnCondition &c, int16 old_value) {
 			LogSpawns("Spawn2 [{}]: Our npcthis is currently not null. The zone thinks it is [{}]. Forcing a depop", spawn2_id, npcthis->GetName());
 			npcthis->Depop(false);	//remove the current mob
 			npcthis = nullptr;
+			Schedule();
 		}
 		if(new_state) { // only get repawn timer remaining when the SpawnCondition is enabled.
 			timer_remaining = database.GetSpawnTimeLeft(spawn2_id,zone->GetInstanceID());
@@ -37,7 +37,7 @@ public:
 	~Spawn2();
 
 	void	LoadGrid(int start_wp = 0);
-	void	Enable() { enabled = true; }
+	void	Enable() { enabled = true; Schedule(); }
 	void	Disable();
 	bool	Enabled() { return enabled; }
 	bool	Process();
@@ -65,8 +65,8 @@ public:
 
 	bool	NPCPointerValid() { return (npcthis!=nullptr); }
 	void	SetNPCPointer(NPC* n) { npcthis = n; }
-	void	SetNPCPointerNull() { npcthis = nullptr; }
-	void	SetTimer(uint32 duration) { timer.Start(duration); }
+	void	SetNPCPointerNull() { npcthis = nullptr; Schedule(); }
+	void	SetTimer(uint32 duration) { timer.Start(duration); Schedule(); }
 	uint32  GetKillCount() { return killcount; }
 protected:
 	friend class Zone;
@@ -76,6 +76,7 @@ private:
 	uint32	respawn_;
 	uint32	resetTimer();
 	uint32	despawnTimer(uint32 despawn_timer);
+	void	Schedule(); // (re)queue on the zone's respawn deadlines after the timer or a blocker changed
 
 	uint32	spawngroup_id_;
 	uint32	currentnpcid;
@@ -92,6 +93,7 @@ private:
 	EmuAppearance anim;
 	bool IsDespawned;
 	uint32  killcount;
+	uint64  schedule_token;
 };
 
 class SpawnCondition {
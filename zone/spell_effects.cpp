@@ -4143,6 +4143,7 @@ void Mob::BuffFadeBySlot(int slot, bool iRecalcBonuses)
 		RemoveNimbusEffect(spells[buffs[slot].spellid].NimbusEffect);
 
 	buffs[slot].spellid = SPELL_UNKNOWN;
+	SetBuffEffectSlot(slot, SPELL_UNKNOWN);
 	if(IsPet() && GetOwner() && GetOwner()->IsClient()) {
 		SendPetBuffsToClient();
 	}
@@ -5297,6 +5298,113 @@ uint16 Client::GetSympatheticFocusEffect(focusType type, uint16 spell_id) {
 	return 0;
 }
 
+// focusType fed by a focus effect in CalcFocusEffect/CalcAAFocus, 0 if none
+static uint8 FocusTypeFromEffect(Mob *mob, uint32 effect)
+{
+	if (effect == SE_TriggerOnCast)
+		return focusTriggerOnCast;
+	if (effect == SE_BlockNextSpellFocus)
+		return focusBlockNextSpell;
+
+	return mob->IsFocusEffect(0, 0, true, effect);
+}
+
+// can CalcFocusEffect(type, focus_id, ...) do anything? the SE_CastonFocusEffect
+// trigger fires for any type that passes the limits, so those always qualify
+static bool IsFocusSpellForType(Mob *mob, uint16 focus_id, focusType type)
+{
+	static int type_effect[HIGHEST_FOCUS + 1];
+	static bool type_effect_built = false;
+
+	if (!type_effect_built) {
+		for (int t = 0; t <= HIGHEST_FOCUS; ++t)
+			type_effect[t] = -1;
+		for (int effect = 0; effect < SPELL_EFFECT_MASK_BITS; ++effect) {
+			uint8 t = FocusTypeFromEffect(mob, effect);
+			if (t && type_effect[t] == -1)
+				type_effect[t] = effect;
+		}
+		type_effect_built = true;
+	}
+
+	if (!IsValidSpell(focus_id))
+		return false;
+
+	const SPDat_Spell_Struct &focus_spell = spells[focus_id];
+	if (SpellEffectMaskHas(focus_spell, SE_CastonFocusEffect))
+		return true;
+
+	return type_effect[type] != -1 && SpellEffectMaskHas(focus_spell, type_effect[type]);
+}
+
+void Client::RebuildFocusIndex()
+{
+	for (int t = 0; t <= HIGHEST_FOCUS; ++t) {
+		item_focus_index[t].clear();
+		aa_focus_index[t].clear();
+	}
+
+	auto add_item_focus = [this](uint16 focus_id, const EQ::ItemData *item) {
+		if (focus_id == 0 || focus_id == SPELL_UNKNOWN)
+			return;
+		for (int t = 1; t <= HIGHEST_FOCUS; ++t) {
+			if (IsFocusSpellForType(this, focus_id, static_cast<focusType>(t)))
+				item_focus_index[t].push_back({ focus_id, item });
+		}
+	};
+
+	// same order GetFocusEffect used to walk them: equipment with its augments, then tribute
+	for (int x = EQ::invslot::EQUIPMENT_BEGIN; x <= EQ::invslot::EQUIPMENT_END; x++) {
+		EQ::ItemInstance* ins = GetInv().GetItem(x);
+		if (!ins)
+			continue;
+
+		const EQ::ItemData* item = ins->GetItem();
+		if (item && item->Focus.Effect > 0)
+			add_item_focus(item->Focus.Effect, item);
+
+		for (int y = EQ::invaug::SOCKET_BEGIN; y <= EQ::invaug::SOCKET_END; ++y) {
+			EQ::ItemInstance *aug = ins->GetAugment(y);
+			if (!aug)
+				continue;
+
+			const EQ::ItemData* aug_item = aug->GetItem();
+			if (aug_item && aug_item->Focus.Effect > 0)
+				add_item_focus(aug_item->Focus.Effect, item);
+		}
+	}
+
+	for (int x = EQ::invslot::TRIBUTE_BEGIN; x <= EQ::invslot::TRIBUTE_END; ++x) {
+		EQ::ItemInstance* ins = GetInv().GetItem(x);
+		if (!ins)
+			continue;
+
+		const EQ::ItemData* item = ins->GetItem();
+		if (item && item->Focus.Effect > 0)
+			add_item_focus(item->Focus.Effect, item);
+	}
+
+	for (const auto &aa : aa_ranks) {
+		auto ability_rank = zone->GetAlternateAdvancementAbilityAndRank(aa.first, aa.second.first);
+		auto ability = ability_rank.first;
+		auto rank = ability_rank.second;
+
+		if (!ability || rank->effects.empty())
+			continue;
+
+		bool types[HIGHEST_FOCUS + 1] = { false };
+		for (const auto &e : rank->effects)
+			types[FocusTypeFromEffect(this, e.effect_id)] = true;
+
+		for (int t = 1; t <= HIGHEST_FOCUS; ++t) {
+			if (types[t])
+				aa_focus_index[t].push_back(rank->id);
+		}
+	}
+
+	focus_index_dirty = false;
+}
+
 int16 Client::GetFocusEffect(focusType type, uint16 spell_id)
 {
 	if (IsBardSong(spell_id) && type != focusFcBaseEffects && type != focusSpellDuration)
@@ -5315,121 +5423,42 @@ int16 Client::GetFocusEffect(focusType type, uint16 spell_id)
 	if(RuleB(Spells, LiveLikeFocusEffects) && (type == focusManaCost || type == focusImprovedHeal || type == focusImprovedDamage || type == focusImprovedDamage2 || type == focusResistRate))
 		rand_effectiveness = true;
 
+	if (focus_index_dirty)
+		RebuildFocusIndex();
+
 	//Check if item focus effect exists for the client.
 	if (itembonuses.FocusEffects[type]){
 
-		const EQ::ItemData* TempItem = nullptr;
 		const EQ::ItemData* UsedItem = nullptr;
 		uint16 UsedFocusID = 0;
 		int16 Total = 0;
 		int16 focus_max = 0;
 		int16 focus_max_real = 0;
 
-		//item focus
-		for (int x = EQ::invslot::EQUIPMENT_BEGIN; x <= EQ::invslot::EQUIPMENT_END; x++)
-		{
-			TempItem = nullptr;
-			EQ::ItemInstance* ins = GetInv().GetItem(x);
-			if (!ins)
-				continue;
-			TempItem = ins->GetItem();
-			if (TempItem && TempItem->Focus.Effect > 0 && TempItem->Focus.Effect != SPELL_UNKNOWN) {
-				if(rand_effectiveness) {
-					focus_max = CalcFocusEffect(type, TempItem->Focus.Effect, spell_id, true);
-					if (focus_max > 0 && focus_max_real >= 0 && focus_max > focus_max_real) {
-						focus_max_real = focus_max;
-						UsedItem = TempItem;
-						UsedFocusID = TempItem->Focus.Effect;
-					} else if (focus_max < 0 && focus_max < focus_max_real) {
-						focus_max_real = focus_max;
-						UsedItem = TempItem;
-						UsedFocusID = TempItem->Focus.Effect;
-					}
-				}
-				else {
-					Total = CalcFocusEffect(type, TempItem->Focus.Effect, spell_id);
-					if (Total > 0 && realTotal >= 0 && Total > realTotal) {
-						realTotal = Total;
-						UsedItem = TempItem;
-						UsedFocusID = TempItem->Focus.Effect;
-					} else if (Total < 0 && Total < realTotal) {
-						realTotal = Total;
-						UsedItem = TempItem;
-						UsedFocusID = TempItem->Focus.Effect;
-					}
-				}
-			}
-
-			for (int y = EQ::invaug::SOCKET_BEGIN; y <= EQ::invaug::SOCKET_END; ++y)
-			{
-				EQ::ItemInstance *aug = nullptr;
-				aug = ins->GetAugment(y);
-				if(aug)
-				{
-					const EQ::ItemData* TempItemAug = aug->GetItem();
-					if (TempItemAug && TempItemAug->Focus.Effect > 0 && TempItemAug->Focus.Effect != SPELL_UNKNOWN) {
-						if(rand_effectiveness) {
-							focus_max = CalcFocusEffect(type, TempItemAug->Focus.Effect, spell_id, true);
-							if (focus_max > 0 && focus_max_real >= 0 && focus_max > focus_max_real) {
-								focus_max_real = focus_max;
-								UsedItem = TempItem;
-								UsedFocusID = TempItemAug->Focus.Effect;
-							} else if (focus_max < 0 && focus_max < focus_max_real) {
-								focus_max_real = focus_max;
-								UsedItem = TempItem;
-								UsedFocusID = TempItemAug->Focus.Effect;
-							}
-						}
-						else {
-							Total = CalcFocusEffect(type, TempItemAug->Focus.Effect, spell_id);
-							if (Total > 0 && realTotal >= 0 && Total > realTotal) {
-								realTotal = Total;
-								UsedItem = TempItem;
-								UsedFocusID = TempItemAug->Focus.Effect;
-							} else if (Total < 0 && Total < realTotal) {
-								realTotal = Total;
-								UsedItem = TempItem;
-								UsedFocusID = TempItemAug->Focus.Effect;
-							}
-						}
-					}
+		//item, augment and tribute focus
+		for (const auto &source : item_focus_index[type]) {
+			if(rand_effectiveness) {
+				focus_max = CalcFocusEffect(type, source.focus_id, spell_id, true);
+				if (focus_max > 0 && focus_max_real >= 0 && focus_max > focus_max_real) {
+					focus_max_real = focus_max;
+					UsedItem = source.item;
+					UsedFocusID = source.focus_id;
+				} else if (focus_max < 0 && focus_max < focus_max_real) {
+					focus_max_real = focus_max;
+					UsedItem = source.item;
+					UsedFocusID = source.focus_id;
 				}
 			}
-		}
-
-		//Tribute Focus
-		for (int x = EQ::invslot::TRIBUTE_BEGIN; x <= EQ::invslot::TRIBUTE_END; ++x)
-		{
-			TempItem = nullptr;
-			EQ::ItemInstance* ins = GetInv().GetItem(x);
-			if (!ins)
-				continue;
-			TempItem = ins->GetItem();
-			if (TempItem && TempItem->Focus.Effect > 0 && TempItem->Focus.Effect != SPELL_UNKNOWN) {
-				if(rand_effectiveness) {
-					focus_max = CalcFocusEffect(type, TempItem->Focus.Effect, spell_id, true);
-					if (focus_max > 0 && focus_max_real >= 0 && focus_max > focus_max_real) {
-						focus_max_real = focus_max;
-						UsedItem = TempItem;
-						UsedFocusID = TempItem->Focus.Effect;
-					} else if (focus_max < 0 && focus_max < focus_max_real) {
-						focus_max_real = focus_max;
-						UsedItem = TempItem;
-						UsedFocusID = TempItem->Focus.Effect;
-					}
-				}
-				else {
-					Total = CalcFocusEffect(type, TempItem->Focus.Effect, spell_id);
-					if (Total > 0 && realTotal >= 0 && Total > realTotal) {
-						realTotal = Total;
-						UsedItem = TempItem;
-						UsedFocusID = TempItem->Focus.Effect;
-					}
-					else if (Total < 0 && Total < realTotal) {
-						realTotal = Total;
-						UsedItem = TempItem;
-						UsedFocusID = TempItem->Focus.Effect;
-					}
+			else {
+				Total = CalcFocusEffect(type, source.focus_id, spell_id);
+				if (Total > 0 && realTotal >= 0 && Total > realTotal) {
+					realTotal = Total;
+					UsedItem = source.item;
+					UsedFocusID = source.focus_id;
+				} else if (Total < 0 && Total < realTotal) {
+					realTotal = Total;
+					UsedItem = source.item;
+					UsedFocusID = source.focus_id;
 				}
 			}
 		}
@@ -5498,6 +5527,9 @@ int16 Client::GetFocusEffect(focusType type, uint16 spell_id)
 			if (focusspellid == 0 || focusspellid >= SPDAT_RECORDS)
 				continue;
 
+			if (!IsFocusSpellForType(this, focusspellid, type))
+				continue;
+
 			if(rand_effectiveness) {
 				focus_max2 = CalcFocusEffect(type, focusspellid, spell_id, true);
 				if (focus_max2 > 0 && focus_max_real2 >= 0 && focus_max2 > focus_max_real2) {
@@ -5539,16 +5571,9 @@ int16 Client::GetFocusEffect(focusType type, uint16 spell_id)
 
 		int16 Total3 = 0;
 
-		for (const auto &aa : aa_ranks) {
-			auto ability_rank = zone->GetAlternateAdvancementAbilityAndRank(aa.first, aa.second.first);
-			auto ability = ability_rank.first;
-			auto rank = ability_rank.second;
-
-			if(!ability) {
-				continue;
-			}
-
-			if (rank->effects.empty())
+		for (auto rank_id : aa_focus_index[type]) {
+			auto rank = zone->GetAlternateAdvancementRank(rank_id);
+			if (!rank)
 				continue;
 
 			Total3 = CalcAAFocus(type, *rank, spell_id);
@@ -6003,6 +6028,9 @@ bool Mob::TryDeathSave() {
 
 bool Mob::AffectedBySpellExcludingSlot(int slot, int effect)
 {
+	if (IsEffectMaskable(effect) && !HasBuffEffect(effect))
+		return false;
+
 	int buff_count = GetMaxTotalSlots();
 	for (int i = 0; i < buff_count; i++)
 	{
@@ -2886,9 +2886,11 @@ int Mob::CheckStackConflict(uint16 spellid1, int caster_level1, uint16 spellid2,
 
 	bool effect_match = true; // Figure out if we're identical in effects on all slots.
 	if (spellid1 != spellid2) {
+		const int32 *effects1 = spells_hot.effectid[spellid1];
+		const int32 *effects2 = spells_hot.effectid[spellid2];
 		for (i = 0; i < EFFECT_COUNT; i++) {
 			// we don't want this optimization for mana burns
-			if (sp1.effectid[i] != sp2.effectid[i] || sp1.effectid[i] == SE_ManaBurn) {
+			if (effects1[i] != effects2[i] || effects1[i] == SE_ManaBurn) {
 				effect_match = false;
 				break;
 			}
@@ -3296,6 +3298,7 @@ int Mob::AddBuff(Mob *caster, uint16 spell_id, int duration, int32 level_overrid
 	assert(buffs[emptyslot].spellid == SPELL_UNKNOWN);	// sanity check
 
 	buffs[emptyslot].spellid = spell_id;
+	SetBuffEffectSlot(emptyslot, spell_id);
 	buffs[emptyslot].casterlevel = caster_level;
 	if (caster && !caster->IsAura()) // maybe some other things we don't want to ...
 		strcpy(buffs[emptyslot].caster_name, caster->GetCleanName());
@@ -4188,6 +4191,9 @@ void Mob::BuffFadeByEffect(int effectid, int skipslot)
 	int i;
 
 	int buff_count = GetMaxTotalSlots();
+	if (IsEffectMaskable(effectid) && !HasBuffEffect(effectid))
+		buff_count = 0;
+
 	for(i = 0; i < buff_count; i++)
 	{
 		if(buffs[i].spellid == SPELL_UNKNOWN)
@@ -5324,13 +5330,67 @@ bool Client::SpellBucketCheck(uint16 spell_id, uint32 char_id) {
     return false;
 }
 
+// each effect id counts once per buff, however many of the spell's slots carry it
+static void AdjustBuffEffectCounts(uint8 *counts, uint16 spell_id, int delta)
+{
+	if (!IsValidSpell(spell_id))
+		return;
+
+	const SPDat_Spell_Struct &spell = spells[spell_id];
+	for (int j = 0; j < EFFECT_COUNT; j++) {
+		int effect = spell.effectid[j];
+		if (!IsEffectMaskable(effect))
+			continue;
+
+		bool seen = false;
+		for (int k = 0; k < j && !seen; k++)
+			seen = spell.effectid[k] == effect;
+		if (seen)
+			continue;
+
+		if (delta > 0 && counts[effect] < 0xFF)
+			counts[effect]++;
+		else if (delta < 0 && counts[effect] > 0)
+			counts[effect]--;
+	}
+}
+
+void Mob::SetBuffEffectSlot(int slot, uint16 spell_id)
+{
+	if (slot < 0)
+		return;
+
+	if (static_cast<size_t>(slot) >= buff_effect_slots.size())
+		buff_effect_slots.resize(slot + 1, SPELL_UNKNOWN);
+
+	if (buff_effect_slots[slot] == spell_id)
+		return;
+
+	AdjustBuffEffectCounts(buff_effect_counts, buff_effect_slots[slot], -1);
+	AdjustBuffEffectCounts(buff_effect_counts, spell_id, 1);
+	buff_effect_slots[slot] = spell_id;
+}
+
+void Mob::SyncBuffEffects()
+{
+	int buff_count = buffs ? GetMaxTotalSlots() : 0;
+	for (int i = 0; i < buff_count; i++)
+		SetBuffEffectSlot(i, buffs[i].spellid);
+
+	for (int i = buff_count; i < static_cast<int>(buff_effect_slots.size()); i++)
+		SetBuffEffectSlot(i, SPELL_UNKNOWN);
+}
+
 // TODO get rid of this
 int16 Mob::GetBuffSlotFromType(uint16 type) {
+	if (IsEffectMaskable(type) && !HasBuffEffect(type))
+		return -1;
+
 	uint32 buff_count = GetMaxTotalSlots();
 	for (int i = 0; i < buff_count; i++) {
 		if (buffs[i].spellid != SPELL_UNKNOWN) {
 			for (int j = 0; j < EFFECT_COUNT; j++) {
-				if (spells[buffs[i].spellid].effectid[j] == type )
+				if (spells_hot.effectid[buffs[i].spellid][j] == type )
 					return i;
 			}
 		}
@@ -5346,18 +5406,28 @@ uint16 Mob::GetSpellIDFromSlot(uint8 slot)
 }
 
 bool Mob::FindType(uint16 type, bool bOffensive, uint16 threshold) {
+	if (IsEffectMaskable(type)) {
+		if (!HasBuffEffect(type))
+			return false;
+		if (!bOffensive)
+			return true;
+	}
+
 	int buff_count = GetMaxTotalSlots();
 	for (int i = 0; i < buff_count; i++) {
 		if (buffs[i].spellid != SPELL_UNKNOWN) {
+			if (IsEffectMaskable(type) && !IsEffectInSpell(buffs[i].spellid, type))
+				continue;
 
+			const int32 *effectid = spells_hot.effectid[buffs[i].spellid];
 			for (int j = 0; j < EFFECT_COUNT; j++) {
 				// adjustments necessary for offensive npc casting behavior
 				if (bOffensive) {
-					if (spells[buffs[i].spellid].effectid[j] == type) {
+					if (effectid[j] == type) {
 						int16 value =
 								CalcSpellEffectValue_formula(spells[buffs[i].spellid].buffdurationformula,
-											spells[buffs[i].spellid].base[j],
-											spells[buffs[i].spellid].max[j],
+											spells_hot.base[buffs[i].spellid][j],
+											spells_hot.max[buffs[i].spellid][j],
 											buffs[i].casterlevel, buffs[i].spellid);
 						Log(Logs::General, Logs::Normal,
 								"FindType: type = %d; value = %d; threshold = %d",
@@ -5366,7 +5436,7 @@ bool Mob::FindType(uint16 type, bool bOffensive, uint16 threshold) {
 							return true;
 					}
 				} else {
-					if (spells[buffs[i].spellid].effectid[j] == type )
+					if (effectid[j] == type )
 						return true;
 				}
 			}
@@ -44,6 +44,8 @@ extern QueryServ* QServ;
 TaskManager::TaskManager() {
 	for(int i=0; i<MAXTASKS; i++)
 		Tasks[i] = nullptr;
+
+	TaskGeneration = 0;
 }
 
 TaskManager::~TaskManager() {
@@ -111,6 +113,8 @@ bool TaskManager::LoadTasks(int singleTask)
 	// If TaskID !=0, then just load the task specified.
 	Log(Logs::General, Logs::Tasks, "[GLOBALLOAD] TaskManager::LoadTasks Called");
 
+	TaskGeneration++;
+
 	std::string query;
 	if (singleTask == 0) {
 		if (!GoalListManager.LoadLists())
@@ -1303,6 +1307,11 @@ ClientTaskState::ClientTaskState() {
 	ActiveTask.slot = 0;
 	ActiveTask.TaskID = TASKSLOTEMPTY;
 	// TODO: shared task
+
+	for (int i = 0; i < MAXACTIVEQUESTS + 1; i++)
+		IndexedTaskIDs[i] = -1;
+
+	IndexedTaskGeneration = 0;
 }
 
 ClientTaskState::~ClientTaskState() {
@@ -1490,6 +1499,78 @@ bool ClientTaskState::UnlockActivities(int CharID, ClientTaskInformation &task_i
 	return false;
 }
 
+static inline uint64 ActivityGoalKey(int ActivityType, int GoalID)
+{
+	return (static_cast<uint64>(static_cast<uint32>(ActivityType)) << 32) | static_cast<uint32>(GoalID);
+}
+
+void ClientTaskState::RefreshActivityIndex()
+{
+	// Slots are filled and emptied from a lot of places (accept, cancel, fail, load, completion),
+	// so rather than hook each of them the index remembers which task it saw in every slot and
+	// rebuilds itself when any of them, or the loaded task data, has changed.
+	bool Stale = IndexedTaskGeneration != taskmanager->TaskGeneration;
+
+	for (int i = 0; !Stale && i < MAXACTIVEQUESTS + 1; i++)
+		Stale = IndexedTaskIDs[i] != ActiveTasks[i].TaskID;
+
+	if (!Stale)
+		return;
+
+	ActivitiesByGoal.clear();
+	ListActivitiesByType.clear();
+	IndexedTaskGeneration = taskmanager->TaskGeneration;
+
+	for (int i = 0; i < MAXACTIVEQUESTS + 1; i++) {
+		IndexedTaskIDs[i] = ActiveTasks[i].TaskID;
+
+		if (ActiveTasks[i].TaskID == TASKSLOTEMPTY)
+			continue;
+
+		TaskInformation *Task = taskmanager->Tasks[ActiveTasks[i].TaskID];
+
+		if (Task == nullptr)
+			continue;
+
+		for (int j = 0; j < Task->ActivityCount; j++) {
+			switch (Task->Activity[j].GoalMethod) {
+			case METHODSINGLEID:
+				ActivitiesByGoal[ActivityGoalKey(Task->Activity[j].Type, Task->Activity[j].GoalID)].push_back(
+				    std::make_pair(i, j));
+				break;
+			case METHODLIST:
+				ListActivitiesByType[Task->Activity[j].Type].push_back(std::make_pair(i, j));
+				break;
+			default:
+				// METHODQUEST activities are only ever updated by the quest itself
+				break;
+			}
+		}
+	}
+}
+
+bool ClientTaskState::GetIndexedActivities(int ActivityType, int GoalID, ActivityRefList &out)
+{
+	out.clear();
+
+	RefreshActivityIndex();
+
+	auto single = ActivitiesByGoal.find(ActivityGoalKey(ActivityType, GoalID));
+	if (single != ActivitiesByGoal.end())
+		out = single->second;
+
+	auto list = ListActivitiesByType.find(ActivityType);
+	if (list != ListActivitiesByType.end()) {
+		bool merge = !out.empty();
+		out.insert(out.end(), list->second.begin(), list->second.end());
+		// keep the slot/activity order the full scan used, an update can unlock the next activity
+		if (merge)
+			std::sort(out.begin(), out.end());
+	}
+
+	return !out.empty();
+}
+
 void ClientTaskState::UpdateTasksOnKill(Client *c, int NPCTypeID) {
 
 	UpdateTasksByNPC(c, ActivityKill, NPCTypeID);
@@ -1513,56 +1594,60 @@ bool ClientTaskState::UpdateTasksByNPC(Client *c, int ActivityType, int NPCTypeI
 	if (!taskmanager || (ActiveTaskCount == 0 && ActiveTask.TaskID == TASKSLOTEMPTY)) // could be better ...
 		return false;
 
-	// loop over the union of tasks and quests
-	for (int i = 0; i < MAXACTIVEQUESTS + 1; i++) {
-		auto cur_task = &ActiveTasks[i];
+	// only the activities that could match this type and goal, in slot order
+	ActivityRefList Candidates;
+	if (!GetIndexedActivities(ActivityType, NPCTypeID, Candidates))
+		return false;
+
+	for (auto &ref : Candidates) {
+		auto cur_task = &ActiveTasks[ref.first];
 		if (cur_task->TaskID == TASKSLOTEMPTY)
 			continue;
 
-		// Check if there are any active kill activities for this task
-
 		auto Task = taskmanager->Tasks[cur_task->TaskID];
 
 		if (Task == nullptr)
-			return false;
+			continue;
 
-		for (int j = 0; j < Task->ActivityCount; j++) {
-			// We are not interested in completed or hidden activities
-			if (cur_task->Activity[j].State != ActivityActive)
-				continue;
-			// We are only interested in Kill activities
-			if (Task->Activity[j].Type != ActivityType)
-				continue;
-			// Is there a zone restriction on the activity ?
-			if (!Task->Activity[j].CheckZone(zone->GetZoneID())) {
-				Log(Logs::General, Logs::Tasks,
-					"[UPDATE] Char: %s Task: %i, Activity %i, Activity type %i for NPC %i failed zone "
-					"check",
-					c->GetName(), cur_task->TaskID, j, ActivityType, NPCTypeID);
-				continue;
-			}
-			// Is the activity to kill this type of NPC ?
-			switch (Task->Activity[j].GoalMethod) {
+		int j = ref.second;
+		if (j >= Task->ActivityCount)
+			continue;
 
-			case METHODSINGLEID:
-				if (Task->Activity[j].GoalID != NPCTypeID)
-					continue;
-				break;
+		// We are not interested in completed or hidden activities
+		if (cur_task->Activity[j].State != ActivityActive)
+			continue;
+		// We are only interested in Kill activities
+		if (Task->Activity[j].Type != ActivityType)
+			continue;
+		// Is there a zone restriction on the activity ?
+		if (!Task->Activity[j].CheckZone(zone->GetZoneID())) {
+			Log(Logs::General, Logs::Tasks,
+				"[UPDATE] Char: %s Task: %i, Activity %i, Activity type %i for NPC %i failed zone "
+				"check",
+				c->GetName(), cur_task->TaskID, j, ActivityType, NPCTypeID);
+			continue;
+		}
+		// Is the activity to kill this type of NPC ?
+		switch (Task->Activity[j].GoalMethod) {
 
-			case METHODLIST:
-				if (!taskmanager->GoalListManager.IsInList(Task->Activity[j].GoalID, NPCTypeID))
-					continue;
-				break;
+		case METHODSINGLEID:
+			if (Task->Activity[j].GoalID != NPCTypeID)
+				continue;
+			break;
 
-			default:
-				// If METHODQUEST, don't update the activity here
+		case METHODLIST:
+			if (!taskmanager->GoalListManager.IsInList(Task->Activity[j].GoalID, NPCTypeID))
 				continue;
-			}
-			// We found an active task to kill this type of NPC, so increment the done count
-			Log(Logs::General, Logs::Tasks, "[UPDATE] Calling increment done count ByNPC");
-			IncrementDoneCount(c, Task, cur_task->slot, j);
-			Ret = true;
+			break;
+
+		default:
+			// If METHODQUEST, don't update the activity here
+			continue;
 		}
+		// We found an active task to kill this type of NPC, so increment the done count
+		Log(Logs::General, Logs::Tasks, "[UPDATE] Calling increment done count ByNPC");
+		IncrementDoneCount(c, Task, cur_task->slot, j);
+		Ret = true;
 	}
 
 	return Ret;
@@ -1657,52 +1742,56 @@ void ClientTaskState::UpdateTasksForItem(Client *c, ActivityType Type, int ItemI
 	if (!taskmanager || (ActiveTaskCount == 0 && ActiveTask.TaskID == TASKSLOTEMPTY)) // could be better ...
 		return;
 
-	// loop over the union of tasks and quests
-	for (int i = 0; i < MAXACTIVEQUESTS + 1; i++) {
-		auto cur_task = &ActiveTasks[i];
+	// only the activities that could match this type and goal, in slot order
+	ActivityRefList Candidates;
+	if (!GetIndexedActivities((int)Type, ItemID, Candidates))
+		return;
+
+	for (auto &ref : Candidates) {
+		auto cur_task = &ActiveTasks[ref.first];
 		if (cur_task->TaskID == TASKSLOTEMPTY)
 			continue;
 
-		// Check if there are any active loot activities for this task
-
-		TaskInformation* Task = taskmanager->Tasks[cur_task->TaskID];
+		auto Task = taskmanager->Tasks[cur_task->TaskID];
 
 		if (Task == nullptr)
-			return;
+			continue;
 
-		for (int j = 0; j < Task->ActivityCount; j++) {
-			// We are not interested in completed or hidden activities
-			if (cur_task->Activity[j].State != ActivityActive)
-				continue;
-			// We are only interested in the ActivityType we were called with
-			if (Task->Activity[j].Type != (int)Type)
-				continue;
-			// Is there a zone restriction on the activity ?
-			if (!Task->Activity[j].CheckZone(zone->GetZoneID())) {
-				Log(Logs::General, Logs::Tasks, "[UPDATE] Char: %s Activity type %i for Item %i failed zone check",
-							c->GetName(), Type, ItemID);
-				continue;
-			}
-			// Is the activity related to this item ?
-			//
-			switch(Task->Activity[j].GoalMethod) {
+		int j = ref.second;
+		if (j >= Task->ActivityCount)
+			continue;
 
-				case METHODSINGLEID:
-					if(Task->Activity[j].GoalID != ItemID) continue;
-					break;
+		// We are not interested in completed or hidden activities
+		if (cur_task->Activity[j].State != ActivityActive)
+			continue;
+		// We are only interested in the ActivityType we were called with
+		if (Task->Activity[j].Type != (int)Type)
+			continue;
+		// Is there a zone restriction on the activity ?
+		if (!Task->Activity[j].CheckZone(zone->GetZoneID())) {
+			Log(Logs::General, Logs::Tasks, "[UPDATE] Char: %s Activity type %i for Item %i failed zone check",
+						c->GetName(), Type, ItemID);
+			continue;
+		}
+		// Is the activity related to this item ?
+		//
+		switch(Task->Activity[j].GoalMethod) {
 
-				case METHODLIST:
-					if(!taskmanager->GoalListManager.IsInList(Task->Activity[j].GoalID, ItemID)) continue;
-					break;
+			case METHODSINGLEID:
+				if(Task->Activity[j].GoalID != ItemID) continue;
+				break;
 
-				default:
-					// If METHODQUEST, don't update the activity here
-					continue;
-			}
-			// We found an active task related to this item, so increment the done count
-			Log(Logs::General, Logs::Tasks, "[UPDATE] Calling increment done count ForItem");
-			IncrementDoneCount(c, Task, cur_task->slot, j, Count);
+			case METHODLIST:
+				if(!taskmanager->GoalListManager.IsInList(Task->Activity[j].GoalID, ItemID)) continue;
+				break;
+
+			default:
+				// If METHODQUEST, don't update the activity here
+				continue;
 		}
+		// We found an active task related to this item, so increment the done count
+		Log(Logs::General, Logs::Tasks, "[UPDATE] Calling increment done count ForItem");
+		IncrementDoneCount(c, Task, cur_task->slot, j, Count);
 	}
 
 	return;
@@ -1717,55 +1806,59 @@ void ClientTaskState::UpdateTasksOnExplore(Client *c, int ExploreID)
 	if (!taskmanager || (ActiveTaskCount == 0 && ActiveTask.TaskID == TASKSLOTEMPTY)) // could be better ...
 		return;
 
-	// loop over the union of tasks and quests
-	for (int i = 0; i < MAXACTIVEQUESTS + 1; i++) {
-		auto cur_task = &ActiveTasks[i];
+	// only the activities that could match this type and goal, in slot order
+	ActivityRefList Candidates;
+	if (!GetIndexedActivities(ActivityExplore, ExploreID, Candidates))
+		return;
+
+	for (auto &ref : Candidates) {
+		auto cur_task = &ActiveTasks[ref.first];
 		if (cur_task->TaskID == TASKSLOTEMPTY)
 			continue;
 
-		// Check if there are any active explore activities for this task
-
-		TaskInformation *Task = taskmanager->Tasks[cur_task->TaskID];
+		auto Task = taskmanager->Tasks[cur_task->TaskID];
 
 		if (Task == nullptr)
-			return;
+			continue;
 
-		for (int j = 0; j < Task->ActivityCount; j++) {
-			// We are not interested in completed or hidden activities
-			if (cur_task->Activity[j].State != ActivityActive)
-				continue;
-			// We are only interested in explore activities
-			if (Task->Activity[j].Type != ActivityExplore)
-				continue;
-			if (!Task->Activity[j].CheckZone(zone->GetZoneID())) {
-				Log(Logs::General, Logs::Tasks,
-				    "[UPDATE] Char: %s Explore exploreid %i failed zone check", c->GetName(),
-				    ExploreID);
-				continue;
-			}
-			// Is the activity to explore this area id ?
-			switch (Task->Activity[j].GoalMethod) {
+		int j = ref.second;
+		if (j >= Task->ActivityCount)
+			continue;
 
-			case METHODSINGLEID:
-				if (Task->Activity[j].GoalID != ExploreID)
-					continue;
-				break;
+		// We are not interested in completed or hidden activities
+		if (cur_task->Activity[j].State != ActivityActive)
+			continue;
+		// We are only interested in explore activities
+		if (Task->Activity[j].Type != ActivityExplore)
+			continue;
+		if (!Task->Activity[j].CheckZone(zone->GetZoneID())) {
+			Log(Logs::General, Logs::Tasks,
+			    "[UPDATE] Char: %s Explore exploreid %i failed zone check", c->GetName(),
+			    ExploreID);
+			continue;
+		}
+		// Is the activity to explore this area id ?
+		switch (Task->Activity[j].GoalMethod) {
 
-			case METHODLIST:
-				if (!taskmanager->GoalListManager.IsInList(Task->Activity[j].GoalID, ExploreID))
-					continue;
-				break;
+		case METHODSINGLEID:
+			if (Task->Activity[j].GoalID != ExploreID)
+				continue;
+			break;
 
-			default:
-				// If METHODQUEST, don't update the activity here
+		case METHODLIST:
+			if (!taskmanager->GoalListManager.IsInList(Task->Activity[j].GoalID, ExploreID))
 				continue;
-			}
-			// We found an active task to explore this area, so set done count to goal count
-			// (Only a goal count of 1 makes sense for explore activities?)
-			Log(Logs::General, Logs::Tasks, "[UPDATE] Increment on explore");
-			IncrementDoneCount(c, Task, cur_task->slot, j,
-					   Task->Activity[j].GoalCount - cur_task->Activity[j].DoneCount);
+			break;
+
+		default:
+			// If METHODQUEST, don't update the activity here
+			continue;
 		}
+		// We found an active task to explore this area, so set done count to goal count
+		// (Only a goal count of 1 makes sense for explore activities?)
+		Log(Logs::General, Logs::Tasks, "[UPDATE] Increment on explore");
+		IncrementDoneCount(c, Task, cur_task->slot, j,
+				   Task->Activity[j].GoalCount - cur_task->Activity[j].DoneCount);
 	}
 
 	return;
@@ -3402,19 +3495,25 @@ bool TaskGoalListManager::LoadLists()
 
 			TaskGoalLists[listIndex].GoalItemEntries.push_back(entry);
 		}
+
+		// IsInList binary searches, don't rely on the collation of the ORDER BY for that
+		std::sort(TaskGoalLists[listIndex].GoalItemEntries.begin(), TaskGoalLists[listIndex].GoalItemEntries.end());
 	}
 
+	std::sort(TaskGoalLists.begin(), TaskGoalLists.end(),
+		  [](const TaskGoalList_Struct &a, const TaskGoalList_Struct &b) { return a.ListID < b.ListID; });
+
 	return true;
 
 }
 
 int TaskGoalListManager::GetListByID(int ListID) {
 
-	// Find the list with the specified ListID and return the index
-	auto it = std::find_if(TaskGoalLists.begin(), TaskGoalLists.end(),
-			       [ListID](const TaskGoalList_Struct &t) { return t.ListID == ListID; });
+	// Find the list with the specified ListID and return the index, the lists are kept sorted by ID
+	auto it = std::lower_bound(TaskGoalLists.begin(), TaskGoalLists.end(), ListID,
+				   [](const TaskGoalList_Struct &t, int id) { return t.ListID < id; });
 
-	if (it == TaskGoalLists.end())
+	if (it == TaskGoalLists.end() || it->ListID != ListID)
 		return -1;
 
 	return std::distance(TaskGoalLists.begin(), it);
@@ -3457,12 +3556,9 @@ bool TaskGoalListManager::IsInList(int ListID, int Entry)
 	if ((Entry < TaskGoalLists[ListIndex].Min) || (Entry > TaskGoalLists[ListIndex].Max))
 		return false;
 
-	int FirstEntry = 0;
 	auto &task = TaskGoalLists[ListIndex];
 
-	auto it = std::find(task.GoalItemEntries.begin(), task.GoalItemEntries.end(), Entry);
-
-	if (it == task.GoalItemEntries.end())
+	if (!std::binary_search(task.GoalItemEntries.begin(), task.GoalItemEntries.end(), Entry))
 		return false;
 
 	Log(Logs::General, Logs::Tasks, "[UPDATE] TaskGoalListManager::IsInList(%i, %i) returning true", ListIndex,
@@ -26,6 +26,8 @@ Copyright (C) 2001-2004 EQEMu Development Team (http://eqemulator.net)
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <unordered_map>
+#include <utility>
 
 #define MAXTASKS 10000
 #define MAXTASKSETS 1000
@@ -244,6 +246,10 @@ public:
 	friend class TaskManager;
 
 private:
+	// (ActiveTasks index, activity) pairs, in the order the slot loops used to visit them
+	typedef std::vector<std::pair<int, int>> ActivityRefList;
+	void RefreshActivityIndex();
+	bool GetIndexedActivities(int ActivityType, int GoalID, ActivityRefList &out);
 	bool UnlockActivities(int CharID, ClientTaskInformation &task_info);
 	void IncrementDoneCount(Client *c, TaskInformation *Task, int TaskIndex, int ActivityID, int Count = 1, bool ignore_quest_update = false);
 	inline ClientTaskInformation *GetClientTaskInfo(TaskType type, int index)
@@ -278,6 +284,12 @@ private:
 	std::vector<CompletedTaskInformation> CompletedTasks;
 	int LastCompletedTaskLoaded;
 	bool CheckedTouchActivities;
+
+	// reverse index of the activities in the active slots, rebuilt when a slot's task or the task data changes
+	int IndexedTaskIDs[MAXACTIVEQUESTS + 1];
+	uint32 IndexedTaskGeneration;
+	std::unordered_map<uint64, ActivityRefList> ActivitiesByGoal; // METHODSINGLEID, keyed by type and goal id
+	std::unordered_map<int, ActivityRefList> ListActivitiesByType; // METHODLIST
 };
 
 
@@ -323,6 +335,7 @@ private:
 	TaskProximityManager ProximityManager;
 	TaskInformation* Tasks[MAXTASKS];
 	std::vector<int> TaskSets[MAXTASKSETS];
+	uint32 TaskGeneration; // bumped on every (re)load so client activity indexes know to rebuild
 	void SendActiveTaskDescription(Client *c, int TaskID, ClientTaskInformation &task_info, int StartTime, int Duration, bool BringUpTaskJournal=false);
 
 };
@@ -2155,7 +2155,7 @@ void WorldServer::HandleMessage(uint16 opcode, const EQ::Net::Packet &p)
 		}
 
 		LogInfo("Loading spells");
-		if (!database.LoadSpells(hotfix_name, &SPDAT_RECORDS, &spells)) {
+		if (!database.LoadSpells(hotfix_name, &SPDAT_RECORDS, &spells, &spells_hot)) {
 			LogError("Loading spells failed!");
 		}
 
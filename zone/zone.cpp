@@ -857,6 +857,12 @@ Zone::Zone(uint32 in_zoneid, uint32 in_instanceid, const char* in_short_name)
 {
 	zoneid = in_zoneid;
 	instanceid = in_instanceid;
+	spawn2_schedule_token = 0;
+	spawn2_clock = 0;
+	spawn2_clock_last = Timer::GetCurrentTime();
+	spawn2_processed_last_tick = 0;
+	spawn2_processed_peak = 0;
+	npctype_db_override_all = false;
 	instanceversion = database.GetInstanceVersion(instanceid);
 	pers_instance = false;
 	zonemap = nullptr;
@@ -967,7 +973,6 @@ Zone::~Zone() {
 	safe_delete_array(short_name);
 	safe_delete_array(long_name);
 	safe_delete(Weather_Timer);
-	NPCEmoteList.Clear();
 	zone_point_list.Clear();
 	entity_list.Clear();
 	ClearBlockedSpells();
@@ -1071,7 +1076,7 @@ bool Zone::Init(bool iStaticZone) {
 	zone->LoadLDoNTrapEntries();
 	zone->LoadVeteranRewards();
 	zone->LoadAlternateCurrencies();
-	zone->LoadNPCEmotes(&NPCEmoteList);
+	zone->LoadNPCEmotes();
 
 	LoadAlternateAdvancement();
 
@@ -1143,8 +1148,7 @@ void Zone::ReloadStaticData() {
 
 	zone->LoadVeteranRewards();
 	zone->LoadAlternateCurrencies();
-	NPCEmoteList.Clear();
-	zone->LoadNPCEmotes(&NPCEmoteList);
+	zone->LoadNPCEmotes();
 
 	//load the zone config file.
 	if (!LoadZoneCFG(zone->GetShortName(), zone->GetInstanceVersion())) // try loading the zone name...
@@ -1286,21 +1290,11 @@ bool Zone::Process() {
 
 	if (spawn2_timer.Check()) {
 
-		LinkedListIterator<Spawn2 *> iterator(spawn2_list);
-
 		EQ::InventoryProfile::CleanDirty();
 
 		LogSpawns("Running Zone::Process -> Spawn2::Process");
 
-		iterator.Reset();
-		while (iterator.MoreElements()) {
-			if (iterator.GetData()->Process()) {
-				iterator.Advance();
-			}
-			else {
-				iterator.RemoveCurrent();
-			}
-		}
+		ProcessSpawn2Deadlines();
 
 		if (adv_data && !did_adventure_actions) {
 			DoAdventureActions();
@@ -1431,6 +1425,10 @@ bool Zone::Process() {
 
 	if(hotzone_timer.Check()) { UpdateHotzone(); }
 
+	if (pathing) {
+		pathing->Process();
+	}
+
 	mMovementManager->Process();
 
 	return true;
@@ -1575,16 +1573,15 @@ void Zone::StartShutdownTimer(uint32 set_time) {
 }
 
 bool Zone::Depop(bool StartSpawnTimer) {
-	std::map<uint32,NPCType *>::iterator itr;
 	entity_list.Depop(StartSpawnTimer);
 	entity_list.ClearTrapPointers();
 	entity_list.UpdateAllTraps(false);
-	/* Refresh npctable (cache), getting current info from database. */
-	while(!npctable.empty()) {
-		itr = npctable.begin();
-		delete itr->second;
-		npctable.erase(itr);
-	}
+	/*
+	 * Refresh npctable (cache), getting current info from database.
+	 * The shared memory npc_types segment was built at boot and misses any npc_types edits
+	 * since, so from here on this zone reads every npc type from the database
+	 */
+	ClearNPCTypeCache(-1);
 
 	// clear spell cache
 	database.ClearNPCSpells();
@@ -1596,6 +1593,7 @@ bool Zone::Depop(bool StartSpawnTimer) {
 
 void Zone::ClearNPCTypeCache(int id) {
 	if (id <= 0) {
+		npctype_db_override_all = true;
 		auto iter = npctable.begin();
 		while (iter != npctable.end()) {
 			delete iter->second;
@@ -1604,6 +1602,8 @@ void Zone::ClearNPCTypeCache(int id) {
 		npctable.clear();
 	}
 	else {
+		npctype_db_overrides.insert((uint32)id);
+
 		auto iter = npctable.begin();
 		while (iter != npctable.end()) {
 			if (iter->first == (uint32)id) {
@@ -1883,6 +1883,8 @@ void Zone::SpawnStatus(Mob* client) {
 		iterator.Advance();
 	}
 	client->Message(Chat::White, "%i spawns listed.", x);
+	client->Message(Chat::White, "%u spawns scheduled, %u processed last tick (peak %u).", GetScheduledSpawn2Count(),
+		GetSpawn2ProcessedLastTick(), GetSpawn2ProcessedPeak());
 }
 
 void Zone::ShowEnabledSpawnStatus(Mob* client)
@@ -2357,28 +2359,43 @@ void Zone::DoAdventureActions()
 
 }
 
-void Zone::LoadNPCEmotes(LinkedList<NPC_Emote_Struct*>* NPCEmoteList)
+void Zone::LoadNPCEmotes()
 {
+	NPCEmoteList.clear();
+	npc_emote_index.clear();
 
-	NPCEmoteList->Clear();
     const std::string query = "SELECT emoteid, event_, type, text FROM npc_emotes";
     auto results = database.QueryDatabase(query);
     if (!results.Success()) {
         return;
     }
 
+	NPCEmoteList.reserve(results.RowCount());
+
     for (auto row = results.begin(); row != results.end(); ++row)
     {
-	    auto nes = new NPC_Emote_Struct;
-	    nes->emoteid = atoi(row[0]);
-	    nes->event_ = atoi(row[1]);
-	    nes->type = atoi(row[2]);
-	    strn0cpy(nes->text, row[3], sizeof(nes->text));
-	    NPCEmoteList->Insert(nes);
+	    NPC_Emote_Struct nes;
+	    nes.emoteid = atoi(row[0]);
+	    nes.event_ = atoi(row[1]);
+	    nes.type = atoi(row[2]);
+	    strn0cpy(nes.text, row[3], sizeof(nes.text));
+
+	    npc_emote_index[(static_cast<uint64>(nes.emoteid) << 8) | nes.event_] = NPCEmoteList.size();
+	    NPCEmoteList.push_back(nes);
     }
 
 }
 
+NPC_Emote_Struct *Zone::GetNPCEmote(uint32 emoteid, uint8 event_)
+{
+	auto iter = npc_emote_index.find((static_cast<uint64>(emoteid) << 8) | event_);
+	if (iter == npc_emote_index.end()) {
+		return nullptr;
+	}
+
+	return &NPCEmoteList[iter->second];
+}
+
 void Zone::ReloadWorld(uint32 Option){
 	if (Option == 0) {
 		entity_list.ClearAreas();
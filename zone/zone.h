@@ -31,6 +31,10 @@
 #include "pathfinder_interface.h"
 #include "global_loot_manager.h"
 
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
+
 struct ZonePoint {
 	float  x;
 	float  y;
@@ -168,11 +172,12 @@ public:
 	int32 MobsAggroCount() { return aggroedmobs; }
 
 	IPathfinder                    *pathing;
-	LinkedList<NPC_Emote_Struct *> NPCEmoteList;
+	std::vector<NPC_Emote_Struct>  NPCEmoteList;
 	LinkedList<Spawn2 *>           spawn2_list;
 	LinkedList<ZonePoint *>        zone_point_list;
 	Map                            *zonemap;
 	MercTemplate *GetMercTemplate(uint32 template_id);
+	NPC_Emote_Struct *GetNPCEmote(uint32 emoteid, uint8 event_);
 	NewZone_Struct                 newzone_data;
 	QGlobalCache *CreateQGlobals()
 	{
@@ -216,6 +221,9 @@ public:
 	uint32 numzonepoints;
 	uint32 CountAuth();
 	uint32 CountSpawn2();
+	uint32 GetScheduledSpawn2Count() const { return static_cast<uint32>(spawn2_scheduled.size()); }
+	uint32 GetSpawn2ProcessedLastTick() const { return spawn2_processed_last_tick; }
+	uint32 GetSpawn2ProcessedPeak() const { return spawn2_processed_peak; }
 	uint32 GetSpawnKillCount(uint32 in_spawnid);
 	uint32 GetTempMerchantQuantity(uint32 NPCID, uint32 Slot);
 
@@ -224,6 +232,7 @@ public:
 	void ChangeWeather();
 	void ClearBlockedSpells();
 	void ClearNPCTypeCache(int id);
+	bool IsNPCTypeCacheOverridden(uint32 id) const { return npctype_db_override_all || npctype_db_overrides.count(id) != 0; }
 	void CalculateNpcUpdateDistanceSpread();
 	void DelAggroMob() { aggroedmobs--; }
 	void DeleteQGlobal(std::string name, uint32 npcID, uint32 charID, uint32 zoneID);
@@ -243,7 +252,7 @@ public:
 	void LoadMercSpells();
 	void LoadMercTemplates();
 	void LoadNewMerchantData(uint32 merchantid);
-	void LoadNPCEmotes(LinkedList<NPC_Emote_Struct *> *NPCEmoteList);
+	void LoadNPCEmotes();
 	void LoadTempMerchantData();
 	void LoadTickItems();
 	void LoadVeteranRewards();
@@ -265,6 +274,7 @@ public:
 	void ShowDisabledSpawnStatus(Mob *client);
 	void ShowEnabledSpawnStatus(Mob *client);
 	void ShowSpawnStatusByID(Mob *client, uint32 spawnid);
+	void ScheduleSpawn2(Spawn2 *spawn);
 	void SpawnConditionChanged(const SpawnCondition &c, int16 old_value);
 	void SpawnStatus(Mob *client);
 	void StartShutdownTimer(uint32 set_time = (RuleI(Zone, AutoShutdownDelay)));
@@ -388,6 +398,33 @@ private:
 	Timer                               qglobal_purge_timer;
 	ZoneSpellsBlocked                   *blocked_spells;
 
+	/**
+	 * Spawn points waiting on their respawn timer, ordered by due time. Entries carry the token
+	 * they were scheduled with; rescheduling or deleting a spawn point just drops its token from
+	 * spawn2_scheduled and the stale heap entry is skipped when it comes due.
+	 */
+	typedef std::pair<uint64, uint64> Spawn2Deadline; // due, token
+	std::priority_queue<Spawn2Deadline, std::vector<Spawn2Deadline>, std::greater<Spawn2Deadline>> spawn2_deadlines;
+	std::unordered_map<uint64, Spawn2 *> spawn2_scheduled;
+	uint64 spawn2_schedule_token;
+	uint64 spawn2_clock;
+	uint32 spawn2_clock_last;
+	uint32 spawn2_processed_last_tick;
+	uint32 spawn2_processed_peak;
+
+	// NPCEmoteList position by (emoteid << 8 | event_), the last row loaded wins like the old list scan did
+	std::unordered_map<uint64, size_t> npc_emote_index;
+
+	// npc types cleared with #npctype_cache are read from the database instead of the shared segment
+	std::unordered_set<uint32> npctype_db_overrides;
+	bool npctype_db_override_all;
+
+	uint64 Spawn2Clock();
+	void ProcessSpawn2Deadlines();
+	void UnscheduleSpawn2(Spawn2 *spawn);
+
+	friend class Spawn2;
+
 };
 
 #endif